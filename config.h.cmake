@@ -33,4 +33,6 @@
 
 #cmakedefine REMOVE_QUIT_BUTTON
 
+#cmakedefine ENABLE_ALLOCATION_TRACKING
+
 #endif /*CONFIG_H*/
@@ -73,6 +73,9 @@ install(FILES ${CMAKE_CURRENT_SOURCE_DIR}/INSTALL.md ${CMAKE_CURRENT_SOURCE_DIR}
 
 install(FILES ${CMAKE_CURRENT_SOURCE_DIR}/data/credits.stxt DESTINATION ${INSTALL_SUBDIR_SHARE})
 
+## Only present if the data_bundle target was built
+install(FILES ${BUILD_CONFIG_DATA_DIR}/data.bundle DESTINATION ${INSTALL_SUBDIR_SHARE} OPTIONAL)
+
 install(FILES ${CMAKE_CURRENT_SOURCE_DIR}/org.supertuxproject.SuperTux.metainfo.xml DESTINATION "share/metainfo" )
 
 install(DIRECTORY
@@ -27,6 +27,7 @@
 #include "audio/sound_file.hpp"
 #include "audio/stream_sound_source.hpp"
 #include "util/log.hpp"
+#include "util/profiler.hpp"
 
 SoundManager::SoundManager() :
   m_device(alcOpenDevice(nullptr)),
@@ -436,6 +437,8 @@ SoundManager::set_listener_orientation(const Vector& at, const Vector& up)
 void
 SoundManager::update()
 {
+  ProfileZone profile_zone("SoundManager::update");
+
   static Uint32 lasttime = SDL_GetTicks();
   Uint32 now = SDL_GetTicks();
 
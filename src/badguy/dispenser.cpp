@@ -27,6 +27,7 @@
 #include "sprite/sprite.hpp"
 #include "supertux/flip_level_transformer.hpp"
 #include "supertux/game_object_factory.hpp"
+#include "supertux/object_prototype.hpp"
 #include "supertux/sector.hpp"
 #include "util/reader_iterator.hpp"
 #include "util/reader_mapping.hpp"
@@ -35,6 +36,7 @@ Dispenser::Dispenser(const ReaderMapping& reader) :
   BadGuy(reader, "images/creatures/dispenser/dropper.sprite", LAYER_OBJECTS + 5),
   m_cycle(),
   m_objects(),
+  m_prototypes(),
   m_next_object(0),
   m_dispense_timer(),
   m_autotarget(false),
@@ -86,6 +88,10 @@ Dispenser::Dispenser(const ReaderMapping& reader) :
   m_countMe = false;
 }
 
+Dispenser::~Dispenser()
+{
+}
+
 void
 Dispenser::add_object(std::unique_ptr<GameObject> object)
 {
@@ -222,7 +228,14 @@ Dispenser::launch_object()
 
     try
     {
-      auto game_object = GameObjectFactory::instance().create(object->get_class_name(), get_pos(), launch_dir, object->save());
+      if (m_prototypes.size() != m_objects.size())
+      {
+        m_prototypes.clear();
+        for (auto& obj : m_objects)
+          m_prototypes.push_back(std::make_unique<ObjectPrototype>(*obj));
+      }
+
+      auto game_object = m_prototypes[m_next_object]->instantiate(get_pos(), launch_dir);
       if (!game_object)
       {
         throw std::runtime_error("Creating " + object->get_class_name() + " object failed.");
@@ -394,6 +407,7 @@ Dispenser::on_type_change(int old_type)
   if (old_type == GRANITO || m_type == GRANITO)
   {
     m_objects.clear();
+    m_prototypes.clear();
     if (m_type == GRANITO) // Switching to type GRANITO
       add_object(GameObjectFactory::instance().create("corrupted_granito"));
   }
@@ -404,6 +418,7 @@ Dispenser::after_editor_set()
 {
   BadGuy::after_editor_set();
   set_correct_action();
+  m_prototypes.clear();
 }
 
 ObjectSettings
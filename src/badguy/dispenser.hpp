@@ -20,6 +20,7 @@
 #include "badguy/badguy.hpp"
 
 class GameObject;
+class ObjectPrototype;
 
 /**
  * @scripting
@@ -39,6 +40,7 @@ private:
 
 public:
   Dispenser(const ReaderMapping& reader);
+  ~Dispenser() override;
 
   virtual void draw(DrawingContext& context) override;
   virtual void initialize() override;
@@ -98,6 +100,10 @@ private:
 private:
   float m_cycle;
   std::vector<std::unique_ptr<GameObject>> m_objects;
+
+  /** Parsed snapshots of m_objects, created on first launch */
+  std::vector<std::unique_ptr<ObjectPrototype>> m_prototypes;
+
   unsigned int m_next_object;
   Timer m_dispense_timer;
   bool m_autotarget;
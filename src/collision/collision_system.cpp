@@ -27,6 +27,7 @@
 #include "supertux/constants.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/tile.hpp"
+#include "util/profiler.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
 
@@ -234,6 +235,8 @@ CollisionSystem::collision_tilemap(collision::Constraints* constraints,
   {
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2));
+    if (!solids->has_attributes(test_tiles, Tile::SOLID))
+      continue;
 
     bool hits_bottom = false;
 
@@ -305,6 +308,8 @@ CollisionSystem::collision_tile_attributes(const Rectf& dest, const Vector& mov)
 
     // For ice (only), add a little fudge to recognize tiles Tux is standing on.
     const Rect test_tiles_ice = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2 + SHIFT_DELTA));
+    if (!solids->has_attributes(test_tiles_ice, ~0u))
+      continue;
 
     for (int x = test_tiles.left; x < test_tiles.right; ++x) {
       int y;
@@ -567,6 +572,8 @@ CollisionSystem::collision_static_constrains(CollisionObject& object)
 void
 CollisionSystem::update()
 {
+  ProfileZone profile_zone("CollisionSystem::update");
+
   if (Editor::is_active()) {
     return;
     // Objects in editor shouldn't collide.
@@ -682,6 +689,12 @@ CollisionSystem::is_free_of_tiles(const Rectf& rect, const bool ignoreUnisolid,
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(rect);
 
+    // Only slopes and unisolid tiles need to be looked at individually.
+    if (!solids->has_attributes(test_tiles, tiletype))
+      continue;
+    if (!solids->has_attributes(test_tiles, Tile::SLOPE | Tile::UNISOLID))
+      return false;
+
     for (int x = test_tiles.left; x < test_tiles.right; ++x) {
       for (int y = test_tiles.top; y < test_tiles.bottom; ++y) {
         const Tile& tile = solids->get_tile(x, y);
@@ -16,6 +16,7 @@
 
 #include "editor/bezier_marker.hpp"
 
+#include "editor/editor.hpp"
 #include "editor/node_marker.hpp"
 #include "object/path_gameobject.hpp"
 #include "supertux/sector.hpp"
@@ -27,6 +28,7 @@ BezierMarker::BezierMarker(Path::Node* node, Vector* bezier_pos) :
   m_parent()
 {
   set_pos(*m_pos - m_offset);
+  Editor::current()->on_object_move(*this);
 }
 
 Vector
@@ -46,6 +48,7 @@ BezierMarker::move_to(const Vector& pos)
 {
   MovingObject::move_to(pos);
   *m_pos = m_col.m_bbox.get_middle();
+  Editor::current()->on_object_move(*this);
 }
 
 void
@@ -479,6 +479,7 @@ Editor::set_sector(Sector* sector)
 
   m_sector = sector;
   m_sector->activate(DEFAULT_SPAWNPOINT_NAME);
+  m_overlay_widget->on_sector_change();
 
   { // Initialize badguy sprites and perform other GameObject related tasks.
     BIND_SECTOR(*m_sector);
@@ -1089,6 +1090,7 @@ Editor::undo()
 {
   BIND_SECTOR(*m_sector);
   m_sector->undo();
+  m_overlay_widget->on_objects_change();
   m_layers_widget->update_current_tip();
 }
 
@@ -1097,6 +1099,7 @@ Editor::redo()
 {
   BIND_SECTOR(*m_sector);
   m_sector->redo();
+  m_overlay_widget->on_objects_change();
   m_layers_widget->update_current_tip();
 }
 
@@ -38,7 +38,9 @@
 
 class ButtonWidget;
 class GameObject;
+class GameObjectManager;
 class Level;
+class MovingObject;
 class ObjectGroup;
 class Path;
 class Savegame;
@@ -154,6 +156,16 @@ public:
 
   void add_layer(GameObject* layer) { m_layers_widget->add_layer(layer); }
 
+  void on_object_add(const GameObjectManager& manager, MovingObject& object) {
+    m_overlay_widget->on_object_add(manager, object);
+  }
+  void on_object_remove(const GameObjectManager& manager, MovingObject& object) {
+    m_overlay_widget->on_object_remove(manager, object);
+  }
+  void on_object_move(MovingObject& object) {
+    m_overlay_widget->on_object_move(object);
+  }
+
   inline TileMap* get_selected_tilemap() const { return m_layers_widget->get_selected_tilemap(); }
 
   inline Sector* get_sector() { return m_sector; }
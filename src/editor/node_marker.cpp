@@ -100,6 +100,7 @@ NodeMarker::move_to(const Vector& pos)
   MovingObject::move_to(pos);
   m_node->position = m_col.m_bbox.get_middle();
   update_node_times();
+  Editor::current()->on_object_move(*this);
 }
 
 void
@@ -160,6 +161,7 @@ NodeMarker::editor_update()
 {
   set_pos(m_node->position - Vector(8, 8));
   update_node_time(m_node, next_node());
+  Editor::current()->on_object_move(*this);
 }
 
 std::vector<Path::Node>::iterator NodeMarker::prev_node() {
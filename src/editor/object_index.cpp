@@ -0,0 +1,236 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "editor/object_index.hpp"
+
+#include <algorithm>
+#include <math.h>
+
+#include "supertux/game_object_manager.hpp"
+#include "supertux/moving_object.hpp"
+
+namespace {
+
+const float CELL_SIZE = 128.0f;
+
+/** Objects covering more cells than this along one axis are not put
+    into the grid. */
+const int MAX_CELL_SPAN = 64;
+
+int to_cell(float coord)
+{
+  return static_cast<int>(floorf(coord / CELL_SIZE));
+}
+
+} // namespace
+
+EditorObjectIndex::EditorObjectIndex() :
+  m_manager(nullptr),
+  m_next_order(0),
+  m_entries(),
+  m_entry_by_object(),
+  m_cells(),
+  m_oversized()
+{
+}
+
+void
+EditorObjectIndex::clear()
+{
+  m_manager = nullptr;
+  m_next_order = 0;
+  m_entries.clear();
+  m_entry_by_object.clear();
+  m_cells.clear();
+  m_oversized.clear();
+}
+
+void
+EditorObjectIndex::rebuild(const GameObjectManager& manager)
+{
+  clear();
+  m_manager = &manager;
+
+  for (auto& object : manager.get_objects_by_type<MovingObject>())
+    add(object);
+}
+
+void
+EditorObjectIndex::add(MovingObject& object)
+{
+  if (m_entry_by_object.find(&object) != m_entry_by_object.end())
+    return;
+
+  Entry entry{ &object, object.get_bbox(), m_next_order++, 0, 0, 0, 0, false };
+  insert_cells(entry);
+
+  m_entry_by_object[&object] = m_entries.size();
+  m_entries.push_back(entry);
+}
+
+void
+EditorObjectIndex::remove(MovingObject& object)
+{
+  auto it = m_entry_by_object.find(&object);
+  if (it == m_entry_by_object.end())
+    return;
+
+  const size_t idx = it->second;
+  erase_cells(m_entries[idx]);
+  m_entry_by_object.erase(it);
+
+  if (idx != m_entries.size() - 1)
+  {
+    m_entries[idx] = m_entries.back();
+    m_entry_by_object[m_entries[idx].object] = idx;
+  }
+  m_entries.pop_back();
+}
+
+void
+EditorObjectIndex::update(MovingObject& object)
+{
+  auto it = m_entry_by_object.find(&object);
+  if (it == m_entry_by_object.end())
+    return;
+
+  Entry& entry = m_entries[it->second];
+  if (entry.bbox == object.get_bbox())
+    return;
+
+  erase_cells(entry);
+  entry.bbox = object.get_bbox();
+  insert_cells(entry);
+}
+
+void
+EditorObjectIndex::query(const Vector& point, std::vector<MovingObject*>& result) const
+{
+  result.clear();
+
+  const int x = to_cell(point.x);
+  const int y = to_cell(point.y);
+  collect(x, y, x, y, result);
+
+  result.erase(std::remove_if(result.begin(), result.end(),
+                              [&point](const MovingObject* object) {
+                                return !object->get_bbox().contains(point);
+                              }),
+               result.end());
+  sort_by_order(result);
+}
+
+void
+EditorObjectIndex::query(const Rectf& rect, std::vector<MovingObject*>& result) const
+{
+  result.clear();
+
+  collect(to_cell(rect.get_left()), to_cell(rect.get_top()),
+          to_cell(rect.get_right()), to_cell(rect.get_bottom()), result);
+
+  // Objects spanning several cells were collected once per cell.
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  result.erase(std::remove_if(result.begin(), result.end(),
+                              [&rect](const MovingObject* object) {
+                                return !rect.overlaps(object->get_bbox());
+                              }),
+               result.end());
+  sort_by_order(result);
+}
+
+void
+EditorObjectIndex::insert_cells(Entry& entry)
+{
+  entry.x1 = to_cell(entry.bbox.get_left());
+  entry.y1 = to_cell(entry.bbox.get_top());
+  entry.x2 = to_cell(entry.bbox.get_right());
+  entry.y2 = to_cell(entry.bbox.get_bottom());
+  entry.oversized = (entry.x2 - entry.x1 > MAX_CELL_SPAN ||
+                     entry.y2 - entry.y1 > MAX_CELL_SPAN);
+
+  if (entry.oversized)
+  {
+    m_oversized.push_back(entry.object);
+    return;
+  }
+
+  for (int y = entry.y1; y <= entry.y2; ++y)
+    for (int x = entry.x1; x <= entry.x2; ++x)
+      m_cells[cell_key(x, y)].push_back(entry.object);
+}
+
+void
+EditorObjectIndex::erase_cells(const Entry& entry)
+{
+  auto erase_from = [&entry](std::vector<MovingObject*>& objects) {
+    auto it = std::find(objects.begin(), objects.end(), entry.object);
+    if (it != objects.end())
+    {
+      *it = objects.back();
+      objects.pop_back();
+    }
+  };
+
+  if (entry.oversized)
+  {
+    erase_from(m_oversized);
+    return;
+  }
+
+  for (int y = entry.y1; y <= entry.y2; ++y)
+  {
+    for (int x = entry.x1; x <= entry.x2; ++x)
+    {
+      auto it = m_cells.find(cell_key(x, y));
+      if (it == m_cells.end())
+        continue;
+
+      erase_from(it->second);
+      if (it->second.empty())
+        m_cells.erase(it);
+    }
+  }
+}
+
+void
+EditorObjectIndex::collect(int x1, int y1, int x2, int y2, std::vector<MovingObject*>& result) const
+{
+  result.insert(result.end(), m_oversized.begin(), m_oversized.end());
+
+  for (int y = y1; y <= y2; ++y)
+  {
+    for (int x = x1; x <= x2; ++x)
+    {
+      auto it = m_cells.find(cell_key(x, y));
+      if (it != m_cells.end())
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    }
+  }
+}
+
+void
+EditorObjectIndex::sort_by_order(std::vector<MovingObject*>& result) const
+{
+  std::sort(result.begin(), result.end(),
+            [this](const MovingObject* lhs, const MovingObject* rhs) {
+              return m_entries[m_entry_by_object.at(lhs)].order <
+                     m_entries[m_entry_by_object.at(rhs)].order;
+            });
+}
+
+/* EOF */
@@ -0,0 +1,107 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_EDITOR_OBJECT_INDEX_HPP
+#define HEADER_SUPERTUX_EDITOR_OBJECT_INDEX_HPP
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "math/rectf.hpp"
+#include "math/vector.hpp"
+
+class GameObjectManager;
+class MovingObject;
+
+/** A uniform grid over the MovingObjects of the sector that is
+    currently edited, used for picking and marquee selection so that
+    mouse movement doesn't require a scan of the whole sector.
+
+    Objects are added and removed through the sector's object hooks.
+    Moves are reported through update() by whatever moves them: the
+    overlay for dragged objects, markers, and objects following a path
+    in editor_update(). Undo/redo drops the index, it is rebuilt on the
+    next query. */
+class EditorObjectIndex final
+{
+private:
+  struct Entry
+  {
+    MovingObject* object;
+    Rectf bbox;
+    uint64_t order;
+    int x1, y1, x2, y2;
+    bool oversized;
+  };
+
+public:
+  EditorObjectIndex();
+
+  /** Drop all entries and detach from the current manager. */
+  void clear();
+
+  /** Index all MovingObjects of the given manager, replacing the
+      previous contents. */
+  void rebuild(const GameObjectManager& manager);
+
+  inline bool is_indexing(const GameObjectManager& manager) const { return m_manager == &manager; }
+
+  void add(MovingObject& object);
+  void remove(MovingObject& object);
+
+  /** Re-bucket a single object after its bounding box has changed. */
+  void update(MovingObject& object);
+
+  /** Collect all objects containing the given point, in the order
+      they were added to the sector. */
+  void query(const Vector& point, std::vector<MovingObject*>& result) const;
+
+  /** Collect all objects overlapping the given rectangle, in the
+      order they were added to the sector. */
+  void query(const Rectf& rect, std::vector<MovingObject*>& result) const;
+
+private:
+  void insert_cells(Entry& entry);
+  void erase_cells(const Entry& entry);
+  void collect(int x1, int y1, int x2, int y2, std::vector<MovingObject*>& result) const;
+  void sort_by_order(std::vector<MovingObject*>& result) const;
+
+  static uint64_t cell_key(int x, int y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+  }
+
+private:
+  const GameObjectManager* m_manager;
+  uint64_t m_next_order;
+
+  std::vector<Entry> m_entries;
+  std::unordered_map<const MovingObject*, size_t> m_entry_by_object;
+  std::unordered_map<uint64_t, std::vector<MovingObject*> > m_cells;
+
+  /** Objects spanning too many cells are kept out of the grid and
+      tested directly, e.g. sector-wide triggers. */
+  std::vector<MovingObject*> m_oversized;
+
+private:
+  EditorObjectIndex(const EditorObjectIndex&) = delete;
+  EditorObjectIndex& operator=(const EditorObjectIndex&) = delete;
+};
+
+#endif
+
+/* EOF */
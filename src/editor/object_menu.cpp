@@ -145,6 +145,9 @@ ObjectMenu::on_back_action()
   m_object->after_editor_set();
   m_object->check_state();
 
+  if (auto* moving_object = dynamic_cast<MovingObject*>(m_object))
+    m_editor.on_object_move(*moving_object);
+
   if (!MenuManager::instance().previous_menu())
   {
     m_editor.m_reactivate_request = true;
@@ -76,6 +76,8 @@ EditorOverlayWidget::EditorOverlayWidget(Editor& editor) :
   m_selected_object(nullptr),
   m_edited_path(nullptr),
   m_last_node_marker(nullptr),
+  m_object_index(),
+  m_picked_objects(),
   m_available_autotilesets(),
   m_current_autotileset(0),
   m_object_tip(new Tip()),
@@ -115,6 +117,47 @@ EditorOverlayWidget::on_level_change()
   m_edited_path = nullptr;
   m_last_node_marker = nullptr;
   m_hovered_object = nullptr;
+  m_object_index.clear();
+}
+
+void
+EditorOverlayWidget::on_sector_change()
+{
+  m_object_index.clear();
+}
+
+void
+EditorOverlayWidget::on_object_add(const GameObjectManager& manager, MovingObject& object)
+{
+  if (m_object_index.is_indexing(manager))
+    m_object_index.add(object);
+}
+
+void
+EditorOverlayWidget::on_object_remove(const GameObjectManager& manager, MovingObject& object)
+{
+  if (m_object_index.is_indexing(manager))
+    m_object_index.remove(object);
+}
+
+void
+EditorOverlayWidget::on_object_move(MovingObject& object)
+{
+  m_object_index.update(object);
+}
+
+void
+EditorOverlayWidget::on_objects_change()
+{
+  m_object_index.clear();
+}
+
+void
+EditorOverlayWidget::sync_object_index()
+{
+  auto* sector = m_editor.get_sector();
+  if (sector && !m_object_index.is_indexing(*sector))
+    m_object_index.rebuild(*sector);
 }
 
 void
@@ -388,6 +431,8 @@ EditorOverlayWidget::fill()
   pos_stack.clear();
   pos_stack.push_back(m_hovered_tile);
 
+  tilemap->save_state();
+
   // Passing recursively trough all tiles to be replaced...
   while (pos_stack.size())
   {
@@ -409,7 +454,8 @@ EditorOverlayWidget::fill()
     }
 
     // Autotile will happen later, so that directional filling works properly
-    input_tile(pos, tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
+    tilemap->change(static_cast<int>(pos.x), static_cast<int>(pos.y),
+                    tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
 
     Vector pos_(0.0f, 0.0f);
 
@@ -483,20 +529,11 @@ EditorOverlayWidget::replace()
   // Don't do anything if the old and new tiles are the same tile.
   if (m_editor.get_tiles()->m_width == 1 && m_editor.get_tiles()->m_height == 1 && replace_tile == m_editor.get_tiles()->pos(0, 0)) return;
 
+  const TileSelection& tiles = *m_editor.get_tiles();
+
   tilemap->save_state();
-  for (int x = 0; x < tilemap->get_width(); ++x)
-  {
-    for (int y = 0; y < tilemap->get_height(); ++y)
-    {
-      if (tilemap->get_tile_id(x, y) == replace_tile)
-      {
-        tilemap->change(x, y, m_editor.get_tiles()->pos(
-          (x - static_cast<int>(m_hovered_tile.x)) % m_editor.get_tiles()->m_width,
-          (y - static_cast<int>(m_hovered_tile.y)) % m_editor.get_tiles()->m_height)
-        );
-      }
-    }
-  }
+  tilemap->change_all(replace_tile, tiles.m_tiles, tiles.m_width, tiles.m_height,
+                      static_cast<int>(m_hovered_tile.x), static_cast<int>(m_hovered_tile.y));
 }
 
 void
@@ -510,46 +547,45 @@ EditorOverlayWidget::hover_object()
   bool cache_is_marker = false;
   int cache_layer = -2147483648;
 
-  for (auto& moving_object : m_editor.get_sector()->get_objects_by_type<MovingObject>())
+  sync_object_index();
+  m_object_index.query(m_sector_pos, m_picked_objects);
+
+  for (auto* moving_object : m_picked_objects)
   {
-    const Rectf& bbox = moving_object.get_bbox();
-    if (bbox.contains(m_sector_pos))
+    if (moving_object != m_hovered_object)
     {
-      if (&moving_object != m_hovered_object)
-      {
 
-        // Ignore BezierMarkers if ctrl isn't pressed... (1/2)
-        auto* bezier_marker = dynamic_cast<BezierMarker*>(&moving_object);
-        if (bezier_marker)
+      // Ignore BezierMarkers if ctrl isn't pressed... (1/2)
+      auto* bezier_marker = dynamic_cast<BezierMarker*>(moving_object);
+      if (bezier_marker)
+      {
+        if (!m_editor.m_ctrl_pressed)
         {
-          if (!m_editor.m_ctrl_pressed)
-          {
-            marker_hovered_without_ctrl = bezier_marker;
-            continue;
-          }
-          else
-          {
-            cache_is_marker = true;
-            cache_layer = 2147483647;
-            m_hovered_object = &moving_object;
-          }
+          marker_hovered_without_ctrl = bezier_marker;
+          continue;
         }
-
-        // Pick objects in this priority:
-        //   1. Markers
-        //   2. Objects with a higher layer ID
-        //   3. If many objects are on the highest layer, pick the last created one
-        //      (Which will be the one rendererd on top)
-
-        bool is_marker = dynamic_cast<MarkerObject*>(&moving_object);
-        // The "=" part of ">=" ensures that for equal layer, the last object is picked; don't remove the "="!
-        if ((is_marker && !cache_is_marker) || moving_object.get_layer() >= cache_layer)
+        else
         {
-          cache_is_marker = is_marker;
-          cache_layer = moving_object.get_layer();
-          m_hovered_object = &moving_object;
+          cache_is_marker = true;
+          cache_layer = 2147483647;
+          m_hovered_object = moving_object;
         }
       }
+
+      // Pick objects in this priority:
+      //   1. Markers
+      //   2. Objects with a higher layer ID
+      //   3. If many objects are on the highest layer, pick the last created one
+      //      (Which will be the one rendererd on top)
+
+      bool is_marker = dynamic_cast<MarkerObject*>(moving_object);
+      // The "=" part of ">=" ensures that for equal layer, the last object is picked; don't remove the "="!
+      if ((is_marker && !cache_is_marker) || moving_object->get_layer() >= cache_layer)
+      {
+        cache_is_marker = is_marker;
+        cache_layer = moving_object->get_layer();
+        m_hovered_object = moving_object;
+      }
     }
   }
 
@@ -721,6 +757,7 @@ EditorOverlayWidget::move_object()
     //}
 
     m_dragged_object->move_to(new_pos);
+    m_object_index.update(*m_dragged_object);
   }
 }
 
@@ -742,14 +779,12 @@ void
 EditorOverlayWidget::rubber_rect()
 {
   delete_markers();
-  Rectf dr = drag_rect();
-  for (auto& moving_object : m_editor.get_sector()->get_objects_by_type<MovingObject>())
-  {
-    const Rectf& bbox = moving_object.get_bbox();
-    if (dr.overlaps(bbox)) {
-      moving_object.editor_delete();
-    }
 
+  sync_object_index();
+  m_object_index.query(drag_rect(), m_picked_objects);
+  for (auto* moving_object : m_picked_objects)
+  {
+    moving_object->editor_delete();
   }
   m_last_node_marker = nullptr;
 }
@@ -1362,51 +1397,28 @@ EditorOverlayWidget::draw_tile_grid(DrawingContext& context, int tile_size, bool
   end.x = std::min(static_cast<float>(current_tm->get_width() * (32 / tile_size)), end.x);
   end.y = std::min(static_cast<float>(current_tm->get_height() * (32 / tile_size)), end.y);
 
-  Vector line_start(0.0f, 0.0f);
-  Vector line_end(0.0f, 0.0f);
-  auto draw_line = [&](const Vector& from, const Vector& to, const Color& col)
-  {
-    context.color().draw_line(from, to, col, current_tm->get_layer());
-  };
+  // The whole grid goes out as a single request per color instead of
+  // one request per line.
+  const float cell_size = static_cast<float>(tile_size) * camera.get_current_scale();
+  start.x = floorf(start.x);
+  start.y = floorf(start.y);
+  if (end.x < start.x || end.y < start.y) return;
+
+  const Rectf region(tile_screen_pos(start, tile_size), tile_screen_pos(end, tile_size));
+
   if (draw_shadow)
   {
     Vector viewport_scale = VideoSystem::current()->get_viewport().get_scale();
     const Color shadow_colour(0.0f, 0.0f, 0.0f, 0.05f);
     const Vector shadow_offset(1.0f / viewport_scale.x,
       1.0f / viewport_scale.y);
-    for (int i = static_cast<int>(start.x); i <= static_cast<int>(end.x); i++)
-    {
-      line_start = tile_screen_pos(Vector(static_cast<float>(i), 0.0f),
-        tile_size) + shadow_offset;
-      line_end = tile_screen_pos(Vector(static_cast<float>(i), end.y),
-        tile_size) + shadow_offset;
-      draw_line(line_start, line_end, shadow_colour);
-    }
-
-    for (int i = static_cast<int>(start.y); i <= static_cast<int>(end.y); i++)
-    {
-      line_start = tile_screen_pos(Vector(0.0f, static_cast<float>(i)),
-        tile_size) + shadow_offset;
-      line_end = tile_screen_pos(Vector(end.x, static_cast<float>(i)),
-        tile_size) + shadow_offset;
-      draw_line(line_start, line_end, shadow_colour);
-    }
+    context.color().draw_grid(region.moved(shadow_offset), Sizef(cell_size, cell_size),
+                              shadow_colour, current_tm->get_layer());
   }
 
   const Color line_color(1.f, 1.f, 1.f, 0.2f);
-  for (int i = static_cast<int>(start.x); i <= static_cast<int>(end.x); i++)
-  {
-    line_start = tile_screen_pos(Vector(static_cast<float>(i), 0.0f), tile_size);
-    line_end = tile_screen_pos(Vector(static_cast<float>(i), end.y), tile_size);
-    draw_line(line_start, line_end, line_color);
-  }
-
-  for (int i = static_cast<int>(start.y); i <= static_cast<int>(end.y); i++)
-  {
-    line_start = tile_screen_pos(Vector(0.0f, static_cast<float>(i)), tile_size);
-    line_end = tile_screen_pos(Vector(end.x, static_cast<float>(i)), tile_size);
-    draw_line(line_start, line_end, line_color);
-  }
+  context.color().draw_grid(region, Sizef(cell_size, cell_size),
+                            line_color, current_tm->get_layer());
 }
 
 void
@@ -1420,10 +1432,11 @@ EditorOverlayWidget::draw_tilemap_border(DrawingContext& context)
   Vector start = tile_screen_pos( Vector(0, 0) );
   Vector end = tile_screen_pos( Vector(static_cast<float>(current_tm->get_width()),
                                        static_cast<float>(current_tm->get_height())) );
-  context.color().draw_line(start, Vector(start.x, end.y), Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(start, Vector(end.x, start.y), Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(Vector(start.x, end.y), end, Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(Vector(end.x, start.y), end, Color(1, 0, 1), current_tm->get_layer());
+  context.color().draw_lines({ start, Vector(start.x, end.y),
+                               start, Vector(end.x, start.y),
+                               Vector(start.x, end.y), end,
+                               Vector(end.x, start.y), end },
+                             Color(1, 0, 1), current_tm->get_layer());
 }
 
 void
@@ -1543,14 +1556,11 @@ EditorOverlayWidget::draw(DrawingContext& context)
     Vector p1 = Vector(p0.x, p3.y);
     Vector p2 = Vector(p3.x, p0.y);
 
-    context.color().draw_filled_rect(Rectf(p0, p1 + Vector(2, 2)),
-                                       Color(0.0f, 1.0f, 0.0f, 1.0f), 0.0f, LAYER_GUI-5);
-    context.color().draw_filled_rect(Rectf(p2, p3 + Vector(2, 2)),
-                                       Color(0.0f, 1.0f, 0.0f, 1.0f), 0.0f, LAYER_GUI-5);
-    context.color().draw_filled_rect(Rectf(p0, p2 + Vector(2, 2)),
-                                       Color(0.0f, 1.0f, 0.0f, 1.0f), 0.0f, LAYER_GUI-5);
-    context.color().draw_filled_rect(Rectf(p1, p3 + Vector(2, 2)),
-                                       Color(0.0f, 1.0f, 0.0f, 1.0f), 0.0f, LAYER_GUI-5);
+    context.color().draw_filled_rects({ Rectf(p0, p1 + Vector(2, 2)),
+                                        Rectf(p2, p3 + Vector(2, 2)),
+                                        Rectf(p0, p2 + Vector(2, 2)),
+                                        Rectf(p1, p3 + Vector(2, 2)) },
+                                      Color(0.0f, 1.0f, 0.0f, 1.0f), LAYER_GUI-5);
 
     context.color().draw_filled_rect(Rectf(p0, p3),
                                        Color(0.0f, 1.0f, 0.0f, 0.2f), 0.0f, LAYER_GUI-5);
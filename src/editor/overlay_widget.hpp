@@ -21,6 +21,7 @@
 #include <chrono>
 
 #include "control/input_manager.hpp"
+#include "editor/object_index.hpp"
 #include "editor/tile_selection.hpp"
 #include "editor/widget.hpp"
 #include "math/vector.hpp"
@@ -33,6 +34,7 @@ class Color;
 class DrawingContext;
 class Editor;
 class GameObject;
+class GameObjectManager;
 class MovingObject;
 class NodeMarker;
 class Path;
@@ -69,6 +71,19 @@ public:
   void delete_markers();
   void update_node_iterators();
   void on_level_change();
+  void on_sector_change();
+
+  /** Keep the object index in sync with the edited sector. */
+  void on_object_add(const GameObjectManager& manager, MovingObject& object);
+  void on_object_remove(const GameObjectManager& manager, MovingObject& object);
+
+  /** Keeps the object index up to date, to be called whenever an
+      object is moved or resized outside of the overlay. */
+  void on_object_move(MovingObject& object);
+
+  /** Drops the object index after changes that can't be tracked per
+      object, e.g. undo/redo. */
+  void on_objects_change();
 
   void edit_path(PathGameObject* path, GameObject* new_marked_object = nullptr);
   //void reset_action_press();
@@ -97,6 +112,7 @@ private:
   void move_object();
   void clone_object();
   void hover_object();
+  void sync_object_index();
   void show_object_menu(GameObject& object);
   void select_object();
   void add_path_node();
@@ -154,6 +170,9 @@ private:
   TypedUID<PathGameObject> m_edited_path;
   TypedUID<NodeMarker> m_last_node_marker;
 
+  EditorObjectIndex m_object_index;
+  std::vector<MovingObject*> m_picked_objects;
+
   std::vector<AutotileSet*> m_available_autotilesets;
   int m_current_autotileset;
 
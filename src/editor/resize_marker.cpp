@@ -16,6 +16,7 @@
 
 #include <algorithm>
 
+#include "editor/editor.hpp"
 #include "editor/resize_marker.hpp"
 #include "supertux/moving_object.hpp"
 
@@ -76,6 +77,7 @@ ResizeMarker::refresh_pos()
   }
 
   set_pos(new_pos);
+  Editor::current()->on_object_move(*this);
 }
 
 void
@@ -103,6 +105,7 @@ ResizeMarker::move_to(const Vector& pos)
       break;
   }
 
+  Editor::current()->on_object_move(*m_object);
   refresh_pos();
 }
 
@@ -15,6 +15,9 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "math/bezier.hpp"
+
+#include <algorithm>
+
 #include "util/log.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
@@ -99,6 +102,75 @@ Bezier::get_point_by_length(const Vector& p1, const Vector& p2, const Vector& p3
   return get_point_at_length(p1, p2, p3, p4, get_length(p1, p2, p3, p4) * t);
 }
 
+namespace {
+
+/** Same number of steps as the defaults of Bezier::get_length() and
+    Bezier::get_point_at_length() */
+const int LENGTH_TABLE_STEPS = 100;
+
+} // namespace
+
+BezierLengthTable::BezierLengthTable() :
+  m_p1(),
+  m_p2(),
+  m_p3(),
+  m_p4(),
+  m_lengths()
+{
+}
+
+void
+BezierLengthTable::update(const Vector& p1, const Vector& p2, const Vector& p3,
+                          const Vector& p4)
+{
+  if (!m_lengths.empty() && p1 == m_p1 && p2 == m_p2 && p3 == m_p3 && p4 == m_p4)
+    return;
+
+  m_p1 = p1;
+  m_p2 = p2;
+  m_p3 = p3;
+  m_p4 = p4;
+
+  const float fsteps = static_cast<float>(LENGTH_TABLE_STEPS);
+
+  m_lengths.resize(LENGTH_TABLE_STEPS + 1);
+  m_lengths[0] = 0.f;
+
+  Vector last = Bezier::get_point(p1, p2, p3, p4, 0.f);
+  for (int i = 1; i <= LENGTH_TABLE_STEPS; i++)
+  {
+    const Vector pos = Bezier::get_point(p1, p2, p3, p4, static_cast<float>(i) / fsteps);
+    m_lengths[i] = m_lengths[i - 1] + glm::length(pos - last);
+    last = pos;
+  }
+}
+
+Vector
+BezierLengthTable::get_point_by_length(const Vector& p1, const Vector& p2, const Vector& p3,
+                                       const Vector& p4, float t)
+{
+  update(p1, p2, p3, p4);
+
+  const float length = m_lengths.back() * t;
+  if (length <= 0.f)
+    return p1;
+
+  // First step whose end lies at or beyond the requested length.
+  auto it = std::lower_bound(m_lengths.begin() + 1, m_lengths.end(), length);
+  if (it == m_lengths.end())
+    return p4;
+
+  const int i = static_cast<int>(it - m_lengths.begin());
+  const float fsteps = static_cast<float>(LENGTH_TABLE_STEPS);
+  const Vector pos = Bezier::get_point(p1, p2, p3, p4, static_cast<float>(i - 1) / fsteps);
+  const Vector nextpos = Bezier::get_point(p1, p2, p3, p4, static_cast<float>(i) / fsteps);
+  const float step = m_lengths[i] - m_lengths[i - 1];
+  if (step <= 0.f)
+    return nextpos;
+
+  return pos + (nextpos - pos) * ((length - m_lengths[i - 1]) / step);
+}
+
 void
 Bezier::draw_curve(DrawingContext& context, const Vector& p1, const Vector& p2,
                    const Vector& p3, const Vector& p4, int steps, Color color,
@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_MATH_BEZIER_HPP
 #define HEADER_SUPERTUX_MATH_BEZIER_HPP
 
+#include <vector>
+
 #include <math/vector.hpp>
 
 class Color;
@@ -43,6 +45,35 @@ private:
   Bezier& operator=(const Bezier&) = delete;
 };
 
+/** Cumulative lengths of a Bezier curve at evenly spaced values of t,
+    so that length-normalized points can be found with a binary search
+    instead of walking the whole curve twice. The table is rebuilt
+    whenever it is used with different control points. */
+class BezierLengthTable final
+{
+public:
+  BezierLengthTable();
+
+  /** Same as Bezier::get_point_by_length() */
+  Vector get_point_by_length(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4, float t);
+
+private:
+  void update(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4);
+
+private:
+  Vector m_p1;
+  Vector m_p2;
+  Vector m_p3;
+  Vector m_p4;
+
+  /** m_lengths[i] is the length of the curve up to t = i / STEPS */
+  std::vector<float> m_lengths;
+
+private:
+  BezierLengthTable(const BezierLengthTable&) = delete;
+  BezierLengthTable& operator=(const BezierLengthTable&) = delete;
+};
+
 #endif
 
 /* EOF */
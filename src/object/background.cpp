@@ -411,71 +411,77 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
   }
   else
   {
+    const Sizef spacing(img_w, img_h);
+
     switch (m_alignment)
     {
       case LEFT_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-        {
-          Vector p(pos_.x - parallax_image_size.width / 2.0f,
-                   pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          m_image->draw(canvas, p, m_layer);
-        }
+        draw_tiles(canvas, *m_image, Vector(pos_.x - parallax_image_size.width / 2.0f, pos_.y - img_h_2),
+                   spacing, 0, start_y, 1, end_y);
         break;
 
       case RIGHT_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-        {
-          Vector p(pos_.x + parallax_image_size.width / 2.0f - img_w,
-                   pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          m_image->draw(canvas, p, m_layer);
-        }
+        draw_tiles(canvas, *m_image, Vector(pos_.x + parallax_image_size.width / 2.0f - img_w, pos_.y - img_h_2),
+                   spacing, 0, start_y, 1, end_y);
         break;
 
       case TOP_ALIGNMENT:
-        for (int x = start_x; x < end_x; ++x)
-        {
-          Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                   pos_.y - parallax_image_size.height / 2.0f);
-          m_image->draw(canvas, p, m_layer);
-        }
+        draw_tiles(canvas, *m_image, Vector(pos_.x - img_w_2, pos_.y - parallax_image_size.height / 2.0f),
+                   spacing, start_x, 0, end_x, 1);
         break;
 
       case BOTTOM_ALIGNMENT:
-        for (int x = start_x; x < end_x; ++x)
-        {
-          Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                   pos_.y - img_h + parallax_image_size.height / 2.0f);
-          m_image->draw(canvas, p, m_layer);
-        }
+        draw_tiles(canvas, *m_image, Vector(pos_.x - img_w_2, pos_.y - img_h + parallax_image_size.height / 2.0f),
+                   spacing, start_x, 0, end_x, 1);
         break;
 
       case NO_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-          for (int x = start_x; x < end_x; ++x)
-          {
-            Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                     pos_.y + static_cast<float>(y) * img_h - img_h_2);
-
-            if (m_image_top && (y < 0))
-            {
-              m_image_top->set_color(m_color);
-              m_image_top->set_blend(m_blend);
-
-              m_image_top->draw(canvas, p, m_layer);
-            }
-            else if (m_image_bottom && (y > 0))
-            {
-              m_image_bottom->set_color(m_color);
-              m_image_bottom->set_blend(m_blend);
-
-              m_image_bottom->draw(canvas, p, m_layer);
-            }
-            else
-            {
-              m_image->draw(canvas, p, m_layer);
-            }
-          }
+      {
+        // Rows above the anchored one show the top image, rows below it
+        // the bottom image, if there are any.
+        Sprite& top = m_image_top ? *m_image_top : *m_image;
+        Sprite& bottom = m_image_bottom ? *m_image_bottom : *m_image;
+
+        top.set_color(m_color);
+        top.set_blend(m_blend);
+        bottom.set_color(m_color);
+        bottom.set_blend(m_blend);
+
+        const Vector origin(pos_.x - img_w_2, pos_.y - img_h_2);
+        draw_tiles(canvas, top, origin, spacing, start_x, start_y, end_x, std::min(end_y, 0));
+        draw_tiles(canvas, *m_image, origin, spacing, start_x, std::max(start_y, 0), end_x, std::min(end_y, 1));
+        draw_tiles(canvas, bottom, origin, spacing, start_x, std::max(start_y, 1), end_x, end_y);
         break;
+      }
+    }
+  }
+}
+
+void
+Background::draw_tiles(Canvas& canvas, Sprite& sprite, const Vector& origin, const Sizef& spacing,
+                       int x1, int y1, int x2, int y2)
+{
+  if (x1 >= x2 || y1 >= y2)
+    return;
+
+  // A single quad only works if the copies of the image touch.
+  if (static_cast<float>(sprite.get_width()) == spacing.width &&
+      static_cast<float>(sprite.get_height()) == spacing.height)
+  {
+    const Rectf dstrect(origin.x + static_cast<float>(x1) * spacing.width,
+                        origin.y + static_cast<float>(y1) * spacing.height,
+                        origin.x + static_cast<float>(x2) * spacing.width,
+                        origin.y + static_cast<float>(y2) * spacing.height);
+    if (sprite.draw_tiled(canvas, dstrect, origin, m_layer))
+      return;
+  }
+
+  for (int y = y1; y < y2; ++y)
+  {
+    for (int x = x1; x < x2; ++x)
+    {
+      sprite.draw(canvas, Vector(origin.x + static_cast<float>(x) * spacing.width,
+                                 origin.y + static_cast<float>(y) * spacing.height), m_layer);
     }
   }
 }
@@ -64,6 +64,11 @@ public:
 
   void draw_image(DrawingContext& context, const Vector& pos);
 
+  /** Draw the image cells [x1, x2) x [y1, y2) of a grid with the
+      given spacing, as a single repeating quad if possible. */
+  void draw_tiles(Canvas& canvas, Sprite& sprite, const Vector& origin, const Sizef& spacing,
+                  int x1, int y1, int x2, int y2);
+
   inline const std::string& get_image() const { return m_imagefile; }
   inline float get_speed() const { return m_parallax_speed.x; }
   int get_layer() const override { return m_layer; }
@@ -129,14 +129,15 @@ Coin::editor_update()
     } else {
       set_pos(get_walker()->get_pos(m_col.m_bbox.get_size(), m_path_handle));
 
-      if (!get_path()) return;
-      if (!get_path()->is_valid()) return;
+      if (get_path() && get_path()->is_valid())
+      {
+        if (m_starting_node >= static_cast<int>(get_path()->get_nodes().size()))
+          m_starting_node = static_cast<int>(get_path()->get_nodes().size()) - 1;
 
-      if (m_starting_node >= static_cast<int>(get_path()->get_nodes().size()))
-        m_starting_node = static_cast<int>(get_path()->get_nodes().size()) - 1;
-
-      set_pos(m_path_handle.get_pos(m_col.m_bbox.get_size(), get_path()->get_nodes()[m_starting_node].position));
+        set_pos(m_path_handle.get_pos(m_col.m_bbox.get_size(), get_path()->get_nodes()[m_starting_node].position));
+      }
     }
+    Editor::current()->on_object_move(*this);
   }
 }
 
@@ -902,8 +902,8 @@ CustomParticleSystem::draw(DrawingContext& context)
   for(auto& it : batches) {
     auto& surface = it.first->texture;
     auto& batch = it.second;
-    context.color().draw_surface_batch(surface, batch.move_srcrects(),
-      batch.move_dstrects(), batch.move_angles(), it.first->color, z_pos);
+    context.color().draw_surface_batch(surface, batch.get_srcrects(),
+      batch.get_dstrects(), batch.get_angles(), it.first->color, z_pos);
   }
 
   context.pop_transform();
@@ -16,6 +16,7 @@
 
 #include "object/particlesystem.hpp"
 
+#include <algorithm>
 #include <math.h>
 
 #include <simplesquirrel/class.hpp>
@@ -29,7 +30,6 @@
 #include "object/camera.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
-#include "video/surface_batch.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 
@@ -40,7 +40,11 @@ ParticleSystem::ParticleSystem(const ReaderMapping& reader, float max_particle_s
   particles(),
   virtual_width(static_cast<float>(SCREEN_WIDTH) + max_particle_size * 2.0f),
   virtual_height(static_cast<float>(SCREEN_HEIGHT) + max_particle_size * 2.0f),
-  enabled(true)
+  enabled(true),
+  m_draw_particles(),
+  m_draw_srcrects(),
+  m_draw_dstrects(),
+  m_draw_angles()
 {
   reader.get("enabled", enabled, true);
   z_pos = reader_get_layer(reader, LAYER_BACKGROUND1);
@@ -52,7 +56,11 @@ ParticleSystem::ParticleSystem(float max_particle_size_) :
   particles(),
   virtual_width(static_cast<float>(SCREEN_WIDTH) + max_particle_size * 2.0f),
   virtual_height(static_cast<float>(SCREEN_HEIGHT) + max_particle_size * 2.0f),
-  enabled(true)
+  enabled(true),
+  m_draw_particles(),
+  m_draw_srcrects(),
+  m_draw_dstrects(),
+  m_draw_angles()
 {
 }
 
@@ -88,7 +96,6 @@ ParticleSystem::draw(DrawingContext& context)
   context.push_transform();
   context.set_translation(Vector(max_particle_size,max_particle_size));
 
-  std::unordered_map<SurfacePtr, SurfaceBatch> batches;
   for (const auto& particle : particles)
   {
     // remap x,y coordinates onto screencoordinates
@@ -108,29 +115,54 @@ ParticleSystem::draw(DrawingContext& context)
     //if(pos.x > virtual_width) pos.x -= virtual_width;
     //if(pos.y > virtual_height) pos.y -= virtual_height;
 
-    auto it = batches.find(particle->texture);
-    if (it == batches.end()) {
-      const auto& batch_it = batches.emplace(particle->texture, SurfaceBatch(particle->texture));
-      batch_it.first->second.draw(pos, particle->angle);
-    } else {
-      it->second.draw(pos, particle->angle);
-    }
+    queue_particle(*particle, pos);
   }
 
-  for(auto& it : batches) {
-    auto& surface = it.first;
-    auto& batch = it.second;
-    context.color().draw_surface_batch(surface,
-                                       batch.move_srcrects(),
-                                       batch.move_dstrects(),
-                                       batch.move_angles(),
-                                       batch.get_color(),
-                                       z_pos);
-  }
+  draw_queued_particles(context);
 
   context.pop_transform();
 }
 
+void
+ParticleSystem::queue_particle(const Particle& particle, const Vector& pos)
+{
+  m_draw_particles.push_back({ &particle, m_draw_particles.size(), pos });
+}
+
+void
+ParticleSystem::draw_queued_particles(DrawingContext& context)
+{
+  // Group the particles by surface, keeping their order within a group.
+  // (std::stable_sort would allocate a temporary buffer.)
+  std::sort(m_draw_particles.begin(), m_draw_particles.end(),
+            [](const DrawParticle& lhs, const DrawParticle& rhs) {
+              if (lhs.particle->texture != rhs.particle->texture)
+                return lhs.particle->texture.get() < rhs.particle->texture.get();
+              return lhs.order < rhs.order;
+            });
+
+  for (auto it = m_draw_particles.begin(); it != m_draw_particles.end();)
+  {
+    const SurfacePtr& surface = it->particle->texture;
+    const Sizef size(static_cast<float>(surface->get_width()),
+                     static_cast<float>(surface->get_height()));
+
+    m_draw_srcrects.clear();
+    m_draw_dstrects.clear();
+    m_draw_angles.clear();
+    for (; it != m_draw_particles.end() && it->particle->texture == surface; ++it)
+    {
+      m_draw_srcrects.emplace_back(Vector(0.0f, 0.0f), size);
+      m_draw_dstrects.emplace_back(it->pos, size);
+      m_draw_angles.push_back(it->particle->angle);
+    }
+
+    context.color().draw_surface_batch(surface, m_draw_srcrects, m_draw_dstrects,
+                                       m_draw_angles, Color::WHITE, z_pos);
+  }
+
+  m_draw_particles.clear();
+}
 
 void
 ParticleSystem::register_class(ssq::VM& vm)
@@ -21,6 +21,7 @@
 
 #include <vector>
 
+#include "math/rectf.hpp"
 #include "math/vector.hpp"
 #include "video/surface_ptr.hpp"
 
@@ -108,6 +109,14 @@ protected:
     Particle& operator=(const Particle&) = delete;
   };
 
+protected:
+  /** Queues a particle for draw_queued_particles(), pos is in the
+      coordinates of the current transform */
+  void queue_particle(const Particle& particle, const Vector& pos);
+
+  /** Draws the queued particles, one batch per surface */
+  void draw_queued_particles(DrawingContext& context);
+
 protected:
   float max_particle_size;
   int z_pos;
@@ -121,6 +130,21 @@ protected:
    */
   bool enabled;
 
+private:
+  struct DrawParticle
+  {
+    const Particle* particle;
+    size_t order;
+    Vector pos;
+  };
+
+  /** Scratch storage of draw(), kept between frames so that drawing
+      doesn't allocate once the buffers have grown large enough */
+  std::vector<DrawParticle> m_draw_particles;
+  std::vector<Rectf> m_draw_srcrects;
+  std::vector<Rectf> m_draw_dstrects;
+  std::vector<float> m_draw_angles;
+
 private:
   ParticleSystem(const ParticleSystem&) = delete;
   ParticleSystem& operator=(const ParticleSystem&) = delete;
@@ -43,7 +43,11 @@ PathWalker::PathWalker(UID path_uid, bool running_) :
   m_stop_at_node_nr(m_running ? -1 : 0),
   m_node_time(0),
   m_node_mult(),
-  m_walking_speed(1.0)
+  m_walking_speed(1.0),
+  m_path_object(nullptr),
+  m_path_object_uid(),
+  m_path_object_sector(nullptr),
+  m_length_table()
 {
   Path* path = get_path();
   if (!path) return;
@@ -55,6 +59,15 @@ PathWalker::PathWalker(UID path_uid, bool running_) :
 
 PathWalker::~PathWalker()
 {
+  if (m_path_object)
+    m_path_object->del_remove_listener(this);
+}
+
+void
+PathWalker::object_removed(GameObject* object)
+{
+  if (object == m_path_object)
+    m_path_object = nullptr;
 }
 
 Path*
@@ -62,6 +75,15 @@ PathWalker::get_path() const
 {
   if (!d_sector) return nullptr;
 
+  if (m_path_object && m_path_object_uid == m_path_uid && m_path_object_sector == d_sector.get())
+    return &m_path_object->get_path();
+
+  if (m_path_object)
+  {
+    m_path_object->del_remove_listener(const_cast<PathWalker*>(this));
+    m_path_object = nullptr;
+  }
+
   auto path_gameobject = d_sector->get_object_by_uid<PathGameObject>(m_path_uid);
   if (!path_gameobject)
   {
@@ -69,6 +91,10 @@ PathWalker::get_path() const
   }
   else
   {
+    m_path_object = path_gameobject;
+    m_path_object_uid = m_path_uid;
+    m_path_object_sector = d_sector.get();
+    m_path_object->add_remove_listener(const_cast<PathWalker*>(this));
     return &path_gameobject->get_path();
   }
 }
@@ -130,7 +156,7 @@ PathWalker::get_pos(const Sizef& object_size, const Handle& handle) const
 
   Vector position = path->m_adapt_speed ?
                           Bezier::get_point(p1, p2, p3, p4, progress) :
-                          Bezier::get_point_by_length(p1, p2, p3, p4, progress);
+                          m_length_table.get_point_by_length(p1, p2, p3, p4, progress);
 
   return handle.get_pos(object_size, position);
 }
@@ -20,15 +20,19 @@
 #include <string.h>
 #include <memory>
 
+#include "math/bezier.hpp"
 #include "math/sizef.hpp"
 #include "object/path.hpp"
+#include "supertux/object_remove_listener.hpp"
 #include "util/uid.hpp"
 
 template<typename T>
 class ObjectOption;
+class PathGameObject;
+class Sector;
 
 /** A walker that travels along a path */
-class PathWalker final
+class PathWalker final : public ObjectRemoveListener
 {
 public:
   /** Helper class that allows to displace a handle on an object */
@@ -45,7 +49,9 @@ public:
 
 public:
   PathWalker(UID path_uid, bool running = true);
-  ~PathWalker();
+  ~PathWalker() override;
+
+  virtual void object_removed(GameObject* object) override;
 
   /** advances the path walker on the path and returns its new position */
   void update(float dt_sec);
@@ -93,6 +99,16 @@ private:
 
   float m_walking_speed;
 
+  /** The path object m_path_uid resolved to in m_path_object_sector,
+      kept until the UID, the sector or the object itself goes away */
+  mutable PathGameObject* m_path_object;
+  mutable UID m_path_object_uid;
+  mutable Sector* m_path_object_sector;
+
+  /** Arc lengths of the segment currently walked, for paths that
+      don't adapt their speed */
+  mutable BezierLengthTable m_length_table;
+
 private:
   PathWalker(const PathWalker&) = delete;
   PathWalker& operator=(const PathWalker&) = delete;
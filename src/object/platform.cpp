@@ -150,6 +150,7 @@ Platform::editor_update()
     m_starting_node = static_cast<int>(get_path()->get_nodes().size()) - 1;
 
   set_pos(m_path_handle.get_pos(m_col.m_bbox.get_size(), get_path()->get_nodes()[m_starting_node].position));
+  Editor::current()->on_object_move(*this);
 }
 
 void
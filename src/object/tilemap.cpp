@@ -16,6 +16,7 @@
 
 #include "object/tilemap.hpp"
 
+#include <algorithm>
 #include <tuple>
 
 #include <simplesquirrel/class.hpp>
@@ -33,6 +34,7 @@
 #include "supertux/flip_level_transformer.hpp"
 #include "collision/collision_object.hpp"
 #include "collision/collision_movement_manager.hpp"
+#include "math/util.hpp"
 #include "util/reader.hpp"
 #include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
@@ -45,6 +47,10 @@ TileMap::TileMap(const TileSet *new_tileset) :
   m_editor_active(true),
   m_tileset(new_tileset),
   m_tiles(),
+  m_attribute_sums(),
+  m_draw_tiles(),
+  m_draw_srcrects(),
+  m_draw_dstrects(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -79,6 +85,10 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
   m_editor_active(true),
   m_tileset(tileset_),
   m_tiles(),
+  m_attribute_sums(),
+  m_draw_tiles(),
+  m_draw_srcrects(),
+  m_draw_dstrects(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -185,16 +195,16 @@ TileMap::parse_tiles(const ReaderMapping& reader)
     if (static_cast<int>(m_tiles.size()) != m_width * m_height)
       throw std::runtime_error("wrong number of tiles in tilemap.");
   }
+  invalidate_attributes();
 
   bool empty = true;
 
-  // make sure all tiles used on the tilemap are loaded and tilemap isn't empty
+  // tiles load their images when first drawn, just check that the tilemap isn't empty
   for (const auto& tile : m_tiles) {
     if (tile != 0) {
       empty = false;
+      break;
     }
-
-    m_tileset->get(tile);
   }
 
   if (empty)
@@ -441,6 +451,10 @@ TileMap::editor_update()
 void
 TileMap::on_flip(float height)
 {
+  // Every tile moves, rebuilding the tables on the next query is cheaper
+  // than updating them for each swap.
+  invalidate_attributes();
+
   for (int x = 0; x < get_width(); ++x) {
     for (int y = 0; y < get_height()/2; ++y) {
       // swap tiles
@@ -496,9 +510,7 @@ TileMap::draw(DrawingContext& context)
   Vector pos(0.0f, 0.0f);
   int tx, ty;
 
-  std::unordered_map<SurfacePtr,
-                     std::tuple<std::vector<Rectf>,
-                                std::vector<Rectf>>> batches;
+  m_draw_tiles.clear();
 
   for (pos.x = start.x, tx = t_draw_rect.left; tx < t_draw_rect.right; pos.x += 32, ++tx) {
     for (pos.y = start.y, ty = t_draw_rect.top; ty < t_draw_rect.bottom; pos.y += 32, ++ty) {
@@ -523,25 +535,35 @@ TileMap::draw(DrawingContext& context)
 
       const SurfacePtr& surface = Editor::is_active() ? tile.get_current_editor_surface() : tile.get_current_surface();
       if (surface) {
-        std::get<0>(batches[surface]).emplace_back(surface->get_region());
-        std::get<1>(batches[surface]).emplace_back(pos,
-                                                   Sizef(static_cast<float>(surface->get_width()),
-                                                         static_cast<float>(surface->get_height())));
+        m_draw_tiles.push_back({ surface, Rectf(surface->get_region()),
+                                 Rectf(pos, Sizef(static_cast<float>(surface->get_width()),
+                                                  static_cast<float>(surface->get_height()))) });
       }
     }
   }
 
   Canvas& canvas = context.get_canvas(m_draw_target);
 
-  for (auto& it : batches)
+  // Group the tiles by surface, each group is drawn as one batch.
+  std::sort(m_draw_tiles.begin(), m_draw_tiles.end(),
+            [](const DrawTile& lhs, const DrawTile& rhs) {
+              return lhs.surface.get() < rhs.surface.get();
+            });
+
+  for (auto it = m_draw_tiles.begin(); it != m_draw_tiles.end();)
   {
-    const SurfacePtr& surface = it.first;
-    if (surface) {
-      canvas.draw_surface_batch(surface,
-                                std::move(std::get<0>(it.second)),
-                                std::move(std::get<1>(it.second)),
-                                m_current_tint, m_z_pos);
+    const SurfacePtr& surface = it->surface;
+
+    m_draw_srcrects.clear();
+    m_draw_dstrects.clear();
+    for (; it != m_draw_tiles.end() && it->surface == surface; ++it)
+    {
+      m_draw_srcrects.push_back(it->srcrect);
+      m_draw_dstrects.push_back(it->dstrect);
     }
+
+    canvas.draw_surface_batch(surface, m_draw_srcrects, m_draw_dstrects,
+                              m_current_tint, m_z_pos);
   }
 
   context.pop_transform();
@@ -551,6 +573,8 @@ void
 TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
              int new_z_pos, bool newsolid)
 {
+  invalidate_attributes();
+
   if (int(newt.size()) != newwidth * newheight)
     throw std::runtime_error("Wrong tilecount count.");
 
@@ -566,16 +590,14 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
     m_z_pos  = new_z_pos;
   m_real_solid  = newsolid;
   update_effective_solid ();
-
-  // make sure all tiles are loaded
-  for (const auto& tile : m_tiles)
-    m_tileset->get(tile);
 }
 
 void
 TileMap::resize(int new_width, int new_height, int fill_id,
                 int xoffset, int yoffset)
 {
+  invalidate_attributes();
+
   bool offset_finished_x = false;
   bool offset_finished_y = false;
   if (xoffset < 0 && new_width - m_width < 0)
@@ -637,6 +659,92 @@ TileMap::get_tiles_overlapping(const Rectf &rect) const
   return Rect(t_left, t_top, t_right, t_bottom);
 }
 
+bool
+TileMap::has_attributes(const Rect& tiles, uint32_t mask) const
+{
+  if (tiles.left >= tiles.right || tiles.top >= tiles.bottom)
+    return false;
+
+  const std::vector<uint32_t>& sums = get_attribute_sums(mask);
+  const int stride = m_width + 1;
+  const uint32_t count = sums[tiles.bottom * stride + tiles.right]
+                       - sums[tiles.top * stride + tiles.right]
+                       - sums[tiles.bottom * stride + tiles.left]
+                       + sums[tiles.top * stride + tiles.left];
+  return count != 0;
+}
+
+const std::vector<uint32_t>&
+TileMap::get_attribute_sums(uint32_t mask) const
+{
+  auto it = m_attribute_sums.find(mask);
+  if (it != m_attribute_sums.end())
+    return it->second;
+
+  const int stride = m_width + 1;
+  std::vector<uint32_t> sums(stride * (m_height + 1), 0);
+  for (int y = 0; y < m_height; ++y)
+  {
+    uint32_t row_sum = 0;
+    for (int x = 0; x < m_width; ++x)
+    {
+      if (m_tileset->get(m_tiles[y * m_width + x]).get_attributes() & mask)
+        row_sum += 1;
+
+      sums[(y + 1) * stride + x + 1] = sums[y * stride + x + 1] + row_sum;
+    }
+  }
+
+  return m_attribute_sums[mask] = std::move(sums);
+}
+
+void
+TileMap::invalidate_attributes(uint32_t attributes)
+{
+  for (auto it = m_attribute_sums.begin(); it != m_attribute_sums.end();)
+  {
+    if (it->first & attributes)
+      it = m_attribute_sums.erase(it);
+    else
+      ++it;
+  }
+}
+
+void
+TileMap::update_attribute_sums(int idx, uint32_t oldtile, uint32_t newtile)
+{
+  if (m_attribute_sums.empty() || oldtile == newtile)
+    return;
+
+  const uint32_t old_attributes = m_tileset->get(oldtile).get_attributes();
+  const uint32_t new_attributes = m_tileset->get(newtile).get_attributes();
+  if (old_attributes == new_attributes)
+    return;
+
+  const int tile_x = idx % m_width;
+  const int tile_y = idx / m_width;
+  const int stride = m_width + 1;
+
+  for (auto& it : m_attribute_sums)
+  {
+    const bool had = (old_attributes & it.first) != 0;
+    const bool has = (new_attributes & it.first) != 0;
+    if (had == has)
+      continue;
+
+    // Every sum covering the tile changes by one, that is all entries
+    // below and to the right of it. Unsigned overflow takes care of -1.
+    const uint32_t delta = has ? 1u : ~0u;
+    std::vector<uint32_t>& sums = it.second;
+    for (int y = tile_y + 1; y <= m_height; ++y)
+    {
+      uint32_t* row = &sums[y * stride];
+      for (int x = tile_x + 1; x <= m_width; ++x)
+        row[x] += delta;
+    }
+  }
+}
+
 void
 TileMap::hits_object_bottom(CollisionObject& object)
 {
@@ -720,12 +828,13 @@ TileMap::change(int x, int y, uint32_t newtile)
   if(x < 0 || x >= m_width || y < 0 || y >= m_height)
     return;
 
-  m_tiles[y*m_width + x] = newtile;
+  change(y*m_width + x, newtile);
 }
 
 void
 TileMap::change(int idx, uint32_t newtile)
 {
+  update_attribute_sums(idx, m_tiles[idx], newtile);
   m_tiles[idx] = newtile;
 }
 
@@ -745,12 +854,30 @@ TileMap::change_at(float x, float y, uint32_t newtile)
 void
 TileMap::change_all(uint32_t oldtile, uint32_t newtile)
 {
-  for (int x = 0; x < get_width(); x++) {
-    for (int y = 0; y < get_height(); y++) {
-      if (get_tile_id(x,y) != oldtile)
-        continue;
+  std::replace(m_tiles.begin(), m_tiles.end(), oldtile, newtile);
+  invalidate_attributes(m_tileset->get(oldtile).get_attributes() ^
+                        m_tileset->get(newtile).get_attributes());
+}
 
-      change(x,y,newtile);
+void
+TileMap::change_all(uint32_t oldtile, const std::vector<uint32_t>& pattern,
+                    int pattern_width, int pattern_height, int origin_x, int origin_y)
+{
+  invalidate_attributes();
+
+  if (pattern_width < 1 || pattern_height < 1 ||
+      pattern.size() < static_cast<size_t>(pattern_width * pattern_height))
+    return;
+
+  for (int y = 0; y < m_height; ++y)
+  {
+    const uint32_t* pattern_row = &pattern[math::positive_mod(y - origin_y, pattern_height) * pattern_width];
+    uint32_t* row = &m_tiles[y * m_width];
+
+    for (int x = 0; x < m_width; ++x)
+    {
+      if (row[x] == oldtile)
+        row[x] = pattern_row[math::positive_mod(x - origin_x, pattern_width)];
     }
   }
 }
@@ -779,7 +906,7 @@ TileMap::autotile(const Vector& pos, uint32_t tile, AutotileSet* autotileset)
   else
   {
     const int pos_x = static_cast<int>(pos.x), pos_y = static_cast<int>(pos.y);
-    m_tiles[pos_y*m_width + pos_x] = tile;
+    change(pos_y*m_width + pos_x, tile);
 
     for (int y = static_cast<int>(pos_y) - 1; y <= static_cast<int>(pos_y) + 1; y++)
     {
@@ -810,7 +937,7 @@ TileMap::autotile_single(int x, int y, AutotileSet* autotileset)
 {
   // autotile() and autotile_erase() already perform validity checks for x, y and autotileset.
 
-  m_tiles[y*m_width + x] = autotileset->get_autotile(m_tiles[y*m_width + x],
+  change(y*m_width + x, autotileset->get_autotile(m_tiles[y*m_width + x],
     autotileset->is_solid(get_tile_id(x-1, y-1)),
     autotileset->is_solid(get_tile_id(x  , y-1)),
     autotileset->is_solid(get_tile_id(x+1, y-1)),
@@ -820,7 +947,7 @@ TileMap::autotile_single(int x, int y, AutotileSet* autotileset)
     autotileset->is_solid(get_tile_id(x-1, y+1)),
     autotileset->is_solid(get_tile_id(x  , y+1)),
     autotileset->is_solid(get_tile_id(x+1, y+1)),
-    x, y);
+    x, y));
 }
 
 void
@@ -847,7 +974,7 @@ TileMap::autotile_single_corner(int x, int y, AutotileSet* autotileset, Autotile
   else if (op == AutotileCornerOperation::ADD_BOTTOM_LEFT) mask = static_cast<uint8_t>(mask | 0x02);
   else if (op == AutotileCornerOperation::ADD_BOTTOM_RIGHT) mask = static_cast<uint8_t>(mask | 0x01);
 
-  m_tiles[y*m_width + x] = (!mask) ? 0 : autotileset->get_autotile(current_tile,
+  change(y*m_width + x, (!mask) ? 0 : autotileset->get_autotile(current_tile,
     (mask & 0x08) != 0,
     false,
     (mask & 0x04) != 0,
@@ -857,7 +984,7 @@ TileMap::autotile_single_corner(int x, int y, AutotileSet* autotileset, Autotile
     (mask & 0x02) != 0,
     false,
     (mask & 0x01) != 0,
-    x, y);
+    x, y));
 }
 
 void
@@ -895,7 +1022,7 @@ TileMap::autotile_erase(const Vector& pos, AutotileSet* autotileset)
     if (current_tile != 0 && !autotileset->is_member(current_tile))
       return;
 
-    m_tiles[pos_y*m_width + pos_x] = 0;
+    change(pos_y*m_width + pos_x, 0);
 
     for (int y = pos_y - 1; y <= pos_y + 1; y++)
     {
@@ -997,7 +1124,7 @@ TileMap::register_class(ssq::VM& vm)
   cls.addFunc<uint32_t, TileMap, float, float>("get_tile_id_at", &TileMap::get_tile_id_at);
   cls.addFunc<void, TileMap, int, int, uint32_t>("change", &TileMap::change);
   cls.addFunc<void, TileMap, float, float, uint32_t>("change_at", &TileMap::change_at);
-  cls.addFunc("change_all", &TileMap::change_all);
+  cls.addFunc<void, TileMap, uint32_t, uint32_t>("change_all", &TileMap::change_all);
   cls.addFunc("fade", &TileMap::fade);
   cls.addFunc<void, TileMap, float, float, float, float, float>("tint_fade", &TileMap::tint_fade);
   cls.addFunc("set_alpha", &TileMap::set_alpha);
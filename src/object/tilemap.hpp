@@ -20,6 +20,7 @@
 #include "editor/layer_object.hpp"
 
 #include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "math/rect.hpp"
@@ -29,6 +30,7 @@
 #include "object/path_walker.hpp"
 #include "supertux/autotile.hpp"
 #include "video/color.hpp"
+#include "video/surface_ptr.hpp"
 #include "video/flip.hpp"
 #include "video/drawing_target.hpp"
 
@@ -140,6 +142,12 @@ public:
       overlap the given rectangle in the sector. */
   Rect get_tiles_overlapping(const Rectf &rect) const;
 
+  /** Returns true if any tile in the given rectangle of tile indices
+      has one of the attribute bits in mask set. A summed-area table is
+      built for every queried mask and kept up to date as single tiles
+      change, so this takes constant time. */
+  bool has_attributes(const Rect& tiles, uint32_t mask) const;
+
   /** Called by the collision mechanism to indicate that this tilemap has been hit on
       the top, i.e. has hit a moving object on the bottom of its collision rectangle. */
   void hits_object_bottom(CollisionObject& object);
@@ -211,6 +219,12 @@ public:
    */
   void change_all(uint32_t oldtile, uint32_t newtile);
 
+  /** Replaces all tiles with the given ID by the tile of a repeating
+      pattern at the same position, the pattern's top left corner
+      being placed at (origin_x, origin_y). */
+  void change_all(uint32_t oldtile, const std::vector<uint32_t>& pattern,
+                  int pattern_width, int pattern_height, int origin_x, int origin_y);
+
   /** Puts the correct autotile blocks at the given position */
   void autotile(const Vector& pos, uint32_t tile, AutotileSet* autotileset);
 
@@ -264,7 +278,7 @@ public:
 
   inline float get_target_alpha() const { return m_alpha; }
 
-  inline void set_tileset(const TileSet* tileset) { m_tileset = tileset; }
+  inline void set_tileset(const TileSet* tileset) { m_tileset = tileset; invalidate_attributes(); }
 
   inline const std::vector<uint32_t>& get_tiles() const { return m_tiles; }
 
@@ -289,6 +303,15 @@ private:
   /** Puts the correct autotile blocks at the tiles around the single given corner */
   void autotile_single_corner(int x, int y, AutotileSet* autotileset, AutotileCornerOperation op);
 
+  /** Drops the summed-area tables of all masks sharing a bit with the
+      given attributes */
+  void invalidate_attributes(uint32_t attributes = ~0u);
+
+  /** Adjusts the summed-area tables in place for a single tile at idx
+      changing from oldtile to newtile */
+  void update_attribute_sums(int idx, uint32_t oldtile, uint32_t newtile);
+  const std::vector<uint32_t>& get_attribute_sums(uint32_t mask) const;
+
   void apply_offset_x(int fill_id, int xoffset);
   void apply_offset_y(int fill_id, int yoffset);
 
@@ -301,6 +324,23 @@ private:
   typedef std::vector<uint32_t> Tiles;
   Tiles m_tiles;
 
+  /** Summed-area tables of (width + 1) * (height + 1) entries, counting
+      the tiles with one of the bits of the key set */
+  mutable std::unordered_map<uint32_t, std::vector<uint32_t> > m_attribute_sums;
+
+  struct DrawTile
+  {
+    SurfacePtr surface;
+    Rectf srcrect;
+    Rectf dstrect;
+  };
+
+  /** Scratch storage of draw(), kept between frames so that drawing
+      doesn't allocate once the buffers have grown large enough */
+  std::vector<DrawTile> m_draw_tiles;
+  std::vector<Rectf> m_draw_srcrects;
+  std::vector<Rectf> m_draw_dstrects;
+
 #ifdef DOXYGEN_SCRIPTING
   /**
    * @scripting
@@ -25,7 +25,8 @@
 
 IFileStreambuf::IFileStreambuf(const std::string& filename) :
   file(),
-  buf()
+  buf(),
+  complete(false)
 {
   // Check this as PHYSFS seems to be buggy and still returns a
   // valid pointer in this case.
@@ -39,6 +40,24 @@ IFileStreambuf::IFileStreambuf(const std::string& filename) :
         << physfsutil::get_last_error();
     throw std::runtime_error(msg.str());
   }
+
+  // Levels, tilesets and the like are parsed in one go, read them
+  // with a single call instead of many small ones.
+  const PHYSFS_sint64 length = PHYSFS_fileLength(file);
+  if (length >= 0 && static_cast<PHYSFS_uint64>(length) <= MAX_WHOLE_FILE_SIZE)
+  {
+    buf.resize(static_cast<size_t>(length));
+    if (PHYSFS_readBytes(file, buf.data(), static_cast<PHYSFS_uint64>(length)) == length)
+    {
+      complete = true;
+      setg(buf.data(), buf.data(), buf.data() + buf.size());
+      return;
+    }
+
+    PHYSFS_seek(file, 0);
+  }
+
+  buf.resize(CHUNK_SIZE);
 }
 
 IFileStreambuf::~IFileStreambuf()
@@ -49,15 +68,19 @@ IFileStreambuf::~IFileStreambuf()
 int
 IFileStreambuf::underflow()
 {
+  if (complete) {
+    return traits_type::eof();
+  }
+
   if (PHYSFS_eof(file)) {
     return traits_type::eof();
   }
 
-  PHYSFS_sint64 bytesread = PHYSFS_readBytes(file, buf, sizeof(buf));
+  PHYSFS_sint64 bytesread = PHYSFS_readBytes(file, buf.data(), buf.size());
   if (bytesread <= 0) {
     return traits_type::eof();
   }
-  setg(buf, buf, buf + bytesread);
+  setg(buf.data(), buf.data(), buf.data() + bytesread);
 
   return static_cast<unsigned char>(buf[0]);
 }
@@ -65,12 +88,21 @@ IFileStreambuf::underflow()
 IFileStreambuf::pos_type
 IFileStreambuf::seekpos(pos_type pos, std::ios_base::openmode)
 {
+  if (complete) {
+    if (pos < 0 || static_cast<size_t>(pos) > buf.size()) {
+      return pos_type(off_type(-1));
+    }
+
+    setg(buf.data(), buf.data() + static_cast<size_t>(pos), buf.data() + buf.size());
+    return pos;
+  }
+
   if (PHYSFS_seek(file, static_cast<PHYSFS_uint64> (pos)) == 0) {
     return pos_type(off_type(-1));
   }
 
   // The seek invalidated the buffer.
-  setg(buf, buf, buf);
+  setg(buf.data(), buf.data(), buf.data());
   return pos;
 }
 
@@ -79,6 +111,25 @@ IFileStreambuf::seekoff(off_type off, std::ios_base::seekdir dir,
                         std::ios_base::openmode mode)
 {
   off_type pos = off;
+
+  if (complete) {
+    switch (dir) {
+      case std::ios_base::beg:
+        break;
+      case std::ios_base::cur:
+        pos += static_cast<off_type> (gptr() - eback());
+        break;
+      case std::ios_base::end:
+        pos += static_cast<off_type> (buf.size());
+        break;
+      default:
+        assert(false);
+        return pos_type(off_type(-1));
+    }
+
+    return seekpos(static_cast<pos_type> (pos), mode);
+  }
+
   PHYSFS_sint64 ptell = PHYSFS_tell(file);
 
   switch (dir) {
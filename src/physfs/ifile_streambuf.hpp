@@ -18,11 +18,16 @@
 #define HEADER_SUPERTUX_PHYSFS_IFILE_STREAMBUF_HPP
 
 #include <streambuf>
+#include <string>
+#include <vector>
 
 struct PHYSFS_File;
 
 /** This class implements a C++ streambuf object for physfs files.
  * So that you can use normal istream operations on them
+ *
+ * Files up to MAX_WHOLE_FILE_SIZE are read with a single read on
+ * open and then served from memory, larger ones are read in chunks.
  */
 class IFileStreambuf final : public std::streambuf
 {
@@ -36,9 +41,16 @@ protected:
                            std::ios_base::openmode) override;
   virtual pos_type seekpos(pos_type pos, std::ios_base::openmode) override;
 
+private:
+  static const size_t MAX_WHOLE_FILE_SIZE = 16 * 1024 * 1024;
+  static const size_t CHUNK_SIZE = 64 * 1024;
+
 private:
   PHYSFS_File* file;
-  char buf[1024];
+  std::vector<char> buf;
+
+  /** true if buf holds the whole file */
+  bool complete;
 
 private:
   IFileStreambuf(const IFileStreambuf&) = delete;
@@ -29,6 +29,8 @@
 
 namespace {
 
+const PHYSFS_uint64 READ_BUFFER_SIZE = 64 * 1024;
+
 Sint64 funcSize(struct SDL_RWops* context)
 {
   PHYSFS_file* file = static_cast<PHYSFS_file*>(context->hidden.unknown.data1);
@@ -122,6 +124,10 @@ SDL_RWops* get_physfs_SDLRWops(const std::string& filename)
     throw std::runtime_error(msg.str());
   }
 
+  // Image and font loaders read in many small pieces, which would
+  // otherwise each go through the archiver.
+  PHYSFS_setBuffer(file, READ_BUFFER_SIZE);
+
   SDL_RWops* ops = new SDL_RWops;
   ops->size = funcSize;
   ops->seek = funcSeek;
@@ -17,12 +17,27 @@
 #include "sprite/sprite.hpp"
 
 #include <assert.h>
+#include <tuple>
 
+#include "sprite/sprite_animation_system.hpp"
 #include "supertux/direction.hpp"
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
+#include "util/object_pool.hpp"
 #include "video/surface.hpp"
 
+namespace {
+
+ObjectPool<Sprite>& get_sprite_pool()
+{
+  // Never destroyed, so sprites held by static objects can still be
+  // freed during shutdown.
+  static ObjectPool<Sprite>* pool = new ObjectPool<Sprite>();
+  return *pool;
+}
+
+} // namespace
+
 Sprite::Sprite(SpriteData& newdata) :
   m_data(newdata),
   m_frame(0),
@@ -34,11 +49,16 @@ Sprite::Sprite(SpriteData& newdata) :
   m_color(1.0f, 1.0f, 1.0f, 1.0f),
   m_blend(),
   m_is_paused(false),
-  m_action(m_data.get_action("default"))
+  m_action(m_data.get_action("default")),
+  m_animation(SpriteAnimationSystem::NONE),
+  m_repeated_source(nullptr),
+  m_repeated_surface()
 {
   if (!m_action)
     m_action = m_data.actions.begin()->second.get();
   m_last_ticks = g_game_time;
+
+  attach_animation();
 }
 
 Sprite::Sprite(const Sprite& other) :
@@ -52,12 +72,35 @@ Sprite::Sprite(const Sprite& other) :
   m_color(1.0f, 1.0f, 1.0f, 1.0f),
   m_blend(),
   m_is_paused(other.m_is_paused),
-  m_action(other.m_action)
+  m_action(other.m_action),
+  m_animation(SpriteAnimationSystem::NONE),
+  m_repeated_source(other.m_repeated_source),
+  m_repeated_surface(other.m_repeated_surface)
 {
+  auto animations = SpriteAnimationSystem::current();
+  if (other.m_animation != SpriteAnimationSystem::NONE && animations)
+  {
+    animations->retain(other.m_animation);
+    m_animation = other.m_animation;
+  }
 }
 
 Sprite::~Sprite()
 {
+  detach_animation();
+}
+
+void*
+Sprite::operator new(size_t size)
+{
+  assert(size == sizeof(Sprite));
+  return get_sprite_pool().allocate();
+}
+
+void
+Sprite::operator delete(void* ptr)
+{
+  get_sprite_pool().deallocate(ptr);
 }
 
 SpritePtr
@@ -71,7 +114,7 @@ Sprite::set_action(const std::string& name, const Direction& dir, int loops)
 {
   if (dir == Direction::NONE)
     set_action(name, loops);
-  else
+  else if (!is_current_action(name, dir_to_string(dir)))
     set_action(name + "-" + dir_to_string(dir), loops);
 }
 
@@ -80,10 +123,25 @@ Sprite::set_action(const Direction& dir, const std::string& name, int loops)
 {
   if (dir == Direction::NONE)
     set_action(name, loops);
-  else
+  else if (!is_current_action(dir_to_string(dir), name))
     set_action(dir_to_string(dir) + "-" + name, loops);
 }
 
+bool
+Sprite::is_current_action(const std::string& prefix, const std::string& suffix) const
+{
+  // Compares against prefix + "-" + suffix without building the string,
+  // as most calls set the action that is already playing.
+  if (!m_action)
+    return false;
+
+  const std::string& name = m_action->name;
+  return name.size() == prefix.size() + 1 + suffix.size() &&
+         name.compare(0, prefix.size(), prefix) == 0 &&
+         name[prefix.size()] == '-' &&
+         name.compare(prefix.size() + 1, suffix.size(), suffix) == 0;
+}
+
 void
 Sprite::set_action(const Direction& dir, int loops)
 {
@@ -104,6 +162,8 @@ Sprite::set_action(const std::string& name, int loops)
     return;
   }
 
+  detach_animation();
+
   // Automatically resume if a new action is set
   m_is_paused = false;
 
@@ -112,6 +172,7 @@ Sprite::set_action(const std::string& name, int loops)
   {
     m_action = newaction;
     update();
+    attach_animation();
     return;
   }
 
@@ -126,6 +187,80 @@ Sprite::set_action(const std::string& name, int loops)
   }
 
   m_action = newaction;
+  attach_animation();
+}
+
+void
+Sprite::set_animation_loops(int loops)
+{
+  detach_animation();
+  m_animation_loops = loops;
+  attach_animation();
+}
+
+void
+Sprite::set_frame_progress(float frame_progress)
+{
+  detach_animation();
+  m_frame = frame_progress;
+}
+
+void
+Sprite::set_frame(int frame)
+{
+  detach_animation();
+  m_frameidx = frame;
+}
+
+void
+Sprite::stop_animation()
+{
+  detach_animation();
+  m_animation_loops = 0;
+}
+
+void
+Sprite::pause_animation()
+{
+  detach_animation();
+  m_is_paused = true;
+}
+
+void
+Sprite::resume_animation()
+{
+  m_is_paused = false;
+  attach_animation();
+}
+
+void
+Sprite::attach_animation()
+{
+  auto animations = SpriteAnimationSystem::current();
+  if (m_animation != SpriteAnimationSystem::NONE || !animations ||
+      m_is_paused || m_animation_loops >= 0 ||
+      m_action->fps <= 0.0f || get_frames() <= 1)
+    return;
+
+  // The game time at which the sprite was at its first frame.
+  const float origin = m_last_ticks - (static_cast<float>(m_frameidx) + m_frame) / m_action->fps;
+  m_animation = animations->acquire(*m_action, origin);
+}
+
+void
+Sprite::detach_animation()
+{
+  if (m_animation == SpriteAnimationSystem::NONE)
+    return;
+
+  if (auto animations = SpriteAnimationSystem::current())
+  {
+    std::tie(m_frameidx, m_frame) = SpriteAnimationSystem::get_frame_at(*m_action, g_game_time - animations->get_origin(m_animation));
+    animations->release(m_animation);
+  }
+
+  m_animation = SpriteAnimationSystem::NONE;
+  m_last_ticks = g_game_time;
 }
 
 bool
@@ -137,6 +272,19 @@ Sprite::animation_done() const
 void
 Sprite::update()
 {
+  if (m_animation != SpriteAnimationSystem::NONE)
+  {
+    if (auto animations = SpriteAnimationSystem::current())
+    {
+      m_frameidx = animations->get_frame(m_animation);
+      m_frame = animations->get_progress(m_animation);
+      m_last_ticks = g_game_time;
+      return;
+    }
+
+    m_animation = SpriteAnimationSystem::NONE;
+  }
+
   float frame_inc = m_action->fps * (g_game_time - m_last_ticks);
   m_last_ticks = g_game_time;
 
@@ -209,6 +357,43 @@ Sprite::draw_scaled(Canvas& canvas, const Rectf& dest_rect, int layer,
   context.pop_transform();
 }
 
+bool
+Sprite::draw_tiled(Canvas& canvas, const Rectf& dest_rect, const Vector& origin, int layer)
+{
+  assert(m_action);
+  update();
+
+  DrawingContext& context = canvas.get_context();
+
+  const SurfacePtr& surface = m_action->surfaces[m_frameidx];
+  if (context.get_flip() != NO_FLIP || surface->get_flip() != NO_FLIP)
+    return false;
+
+  if (surface.get() != m_repeated_source)
+  {
+    m_repeated_source = surface.get();
+    m_repeated_surface = surface->repeated();
+  }
+
+  if (!m_repeated_surface)
+    return false;
+
+  context.push_transform();
+  context.set_alpha(context.get_alpha() * m_alpha);
+
+  PaintStyle style;
+  style.set_color(m_color);
+  style.set_blend(m_blend);
+
+  const Vector image_pos = origin - Vector(m_action->x_offset, m_action->y_offset);
+  canvas.draw_surface_part(m_repeated_surface,
+                           Rectf(dest_rect.p1() - image_pos, dest_rect.get_size()),
+                           dest_rect, layer, style);
+
+  context.pop_transform();
+  return true;
+}
+
 int
 Sprite::get_width() const
 {
@@ -34,6 +34,11 @@ public:
   Sprite(SpriteData& data);
   ~Sprite();
 
+  /** Sprites are taken from an ObjectPool, as short-lived effect
+      objects create and destroy them all the time. */
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   SpritePtr clone() const;
 
   /** Draw sprite, automatically calculates next frame */
@@ -42,6 +47,12 @@ public:
   void draw_scaled(Canvas& canvas, const Rectf& dest_rect, int layer,
                    Flip flip = NO_FLIP);
 
+  /** Fill dest_rect with copies of the current frame in a single
+      request, letting the texture repeat. 'origin' is the position
+      one of the copies would be drawn at by draw(). Returns false
+      and draws nothing if the frame can't be repeated that way. */
+  bool draw_tiled(Canvas& canvas, const Rectf& dest_rect, const Vector& origin, int layer);
+
   /** Set action (or state) */
   void set_action(const std::string& name, int loops = -1);
 
@@ -61,17 +72,17 @@ public:
   void set_action(const Direction& dir, int loops = -1);
 
   /** Set number of animation cycles until animation stops */
-  inline void set_animation_loops(int loops = -1) { m_animation_loops = loops; }
+  void set_animation_loops(int loops = -1);
 
-  inline void set_frame_progress(float frame_progress) { m_frame = frame_progress; }
+  void set_frame_progress(float frame_progress);
 
-  inline void set_frame(int frame) { m_frameidx = frame; }
+  void set_frame(int frame);
 
   /* Stop animation */
-  void stop_animation() { m_animation_loops = 0; }
+  void stop_animation();
 
-  void pause_animation() { m_is_paused = true; }
-  void resume_animation() { m_is_paused = false; }
+  void pause_animation();
+  void resume_animation();
 
   /** Check if animation is stopped or not */
   bool animation_done() const;
@@ -129,6 +140,17 @@ public:
 private:
   void update();
 
+  /** Hand the animation over to the SpriteAnimationSystem if it
+      loops endlessly, sharing it with sprites that are in lockstep. */
+  void attach_animation();
+
+  /** Take the animation back from the SpriteAnimationSystem, needed
+      before it is changed in any way. */
+  void detach_animation();
+
+  /** Returns true if the current action is named prefix-suffix */
+  bool is_current_action(const std::string& prefix, const std::string& suffix) const;
+
   SpriteData& m_data;
 
   // between 0 and 1
@@ -145,6 +167,14 @@ private:
 
   const SpriteData::Action* m_action;
 
+  /** Handle of the shared animation, SpriteAnimationSystem::NONE if
+      the sprite advances on its own */
+  size_t m_animation;
+
+  /** Repeating version of the frame last drawn by draw_tiled() */
+  const Surface* m_repeated_source;
+  SurfacePtr m_repeated_surface;
+
 private:
   Sprite(const Sprite& other);
   Sprite& operator=(const Sprite&) = delete;
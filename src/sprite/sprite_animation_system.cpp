@@ -0,0 +1,123 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "sprite/sprite_animation_system.hpp"
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include <tuple>
+
+#include "supertux/globals.hpp"
+#include "util/profiler.hpp"
+
+std::pair<int, float>
+SpriteAnimationSystem::get_frame_at(const SpriteData::Action& action, float elapsed)
+{
+  const int frames = static_cast<int>(action.surfaces.size());
+  if (frames <= 1 || elapsed <= 0.0f)
+    return { 0, 0.0f };
+
+  const float total = action.fps * elapsed;
+  const float whole = floorf(total);
+  int frame = static_cast<int>(whole);
+
+  // After the first pass only the frames from loop_frame on repeat,
+  // same as in Sprite::update().
+  if (frame >= frames)
+  {
+    const int loop_start = std::min(std::max(action.loop_frame - 1, 0), frames - 1);
+    frame = loop_start + (frame - loop_start) % (frames - loop_start);
+  }
+
+  return { frame, total - whole };
+}
+
+SpriteAnimationSystem::SpriteAnimationSystem() :
+  m_animations(),
+  m_free(),
+  m_lookup()
+{
+}
+
+void
+SpriteAnimationSystem::update()
+{
+  ProfileZone profile_zone("SpriteAnimationSystem::update");
+
+  for (auto& animation : m_animations)
+  {
+    if (animation.refs == 0)
+      continue;
+
+    std::tie(animation.frame, animation.progress) = get_frame_at(*animation.action, g_game_time - animation.origin);
+  }
+}
+
+size_t
+SpriteAnimationSystem::acquire(const SpriteData::Action& action, float origin)
+{
+  const auto key = std::make_pair(&action, origin);
+  auto it = m_lookup.find(key);
+  if (it != m_lookup.end())
+  {
+    m_animations[it->second].refs += 1;
+    return it->second;
+  }
+
+  Animation animation{ &action, origin, 0, 0.0f, 1 };
+  std::tie(animation.frame, animation.progress) = get_frame_at(action, g_game_time - origin);
+
+  size_t handle;
+  if (m_free.empty())
+  {
+    handle = m_animations.size();
+    m_animations.push_back(animation);
+  }
+  else
+  {
+    handle = m_free.back();
+    m_free.pop_back();
+    m_animations[handle] = animation;
+  }
+
+  m_lookup[key] = handle;
+  return handle;
+}
+
+void
+SpriteAnimationSystem::retain(size_t handle)
+{
+  assert(m_animations[handle].refs > 0);
+  m_animations[handle].refs += 1;
+}
+
+void
+SpriteAnimationSystem::release(size_t handle)
+{
+  Animation& animation = m_animations[handle];
+  assert(animation.refs > 0);
+
+  animation.refs -= 1;
+  if (animation.refs == 0)
+  {
+    m_lookup.erase(std::make_pair(animation.action, animation.origin));
+    m_free.push_back(handle);
+  }
+}
+
+/* EOF */
@@ -0,0 +1,83 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SPRITE_SPRITE_ANIMATION_SYSTEM_HPP
+#define HEADER_SUPERTUX_SPRITE_SPRITE_ANIMATION_SYSTEM_HPP
+
+#include "util/currenton.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "sprite/sprite_data.hpp"
+
+/** Keeps the state of all endlessly looping sprite animations in one
+    place. Sprites that play the same action in lockstep, e.g. all the
+    coins of a level, share a single animation, which is advanced once
+    per frame by update() instead of once per sprite and draw. */
+class SpriteAnimationSystem final : public Currenton<SpriteAnimationSystem>
+{
+public:
+  static const size_t NONE = static_cast<size_t>(-1);
+
+  /** Frame index and progress of an action that has been playing for
+      'elapsed' seconds. */
+  static std::pair<int, float> get_frame_at(const SpriteData::Action& action, float elapsed);
+
+private:
+  struct Animation
+  {
+    const SpriteData::Action* action;
+
+    /** Game time at which the animation was at its first frame */
+    float origin;
+
+    int frame;
+    float progress;
+    int refs;
+  };
+
+public:
+  SpriteAnimationSystem();
+
+  /** Advance all animations to g_game_time. */
+  void update();
+
+  /** Returns the animation of 'action' that was at its first frame at
+      game time 'origin', creating it if needed. */
+  size_t acquire(const SpriteData::Action& action, float origin);
+  void retain(size_t handle);
+  void release(size_t handle);
+
+  inline int get_frame(size_t handle) const { return m_animations[handle].frame; }
+  inline float get_progress(size_t handle) const { return m_animations[handle].progress; }
+  inline float get_origin(size_t handle) const { return m_animations[handle].origin; }
+
+private:
+  std::vector<Animation> m_animations;
+  std::vector<size_t> m_free;
+  std::map<std::pair<const SpriteData::Action*, float>, size_t> m_lookup;
+
+private:
+  SpriteAnimationSystem(const SpriteAnimationSystem&) = delete;
+  SpriteAnimationSystem& operator=(const SpriteAnimationSystem&) = delete;
+};
+
+#endif
+
+/* EOF */
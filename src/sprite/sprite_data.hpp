@@ -29,6 +29,7 @@ class ReaderMapping;
 class SpriteData final
 {
   friend class Sprite;
+  friend class SpriteAnimationSystem;
 
 public:
   SpriteData(const std::string& filename);
@@ -28,6 +28,7 @@
 #include "supertux/console.hpp"
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
+#include "util/profiler.hpp"
 
 #ifdef ENABLE_SQDBG
 #  include "../../external/squirrel/sqdbg/sqrdbg.h"
@@ -118,6 +119,8 @@ SquirrelVirtualMachine::~SquirrelVirtualMachine()
 void
 SquirrelVirtualMachine::update(float dt_sec)
 {
+  ProfileZone profile_zone("SquirrelVirtualMachine::update");
+
   update_debugger();
   m_scheduler->update(g_game_time);
 }
@@ -41,6 +41,9 @@
 #include "supertux/sector.hpp"
 #include "supertux/textscroller_screen.hpp"
 #include "supertux/title_screen.hpp"
+#include "video/frame_capture.hpp"
+#include "video/render_stats.hpp"
+#include "video/video_system.hpp"
 #include "worldmap/worldmap.hpp"
 
 namespace scripting {
@@ -334,6 +337,23 @@ static void debug_show_fps(bool enable)
 {
   g_config->show_fps = enable;
 }
+/**
+ * @scripting
+ * @description Prints the draw call, texture bind, blend change, vertex and upload counts of the last frame, as well as the GPU time of each render pass, if available.
+ */
+static void debug_render_stats()
+{
+  ConsoleBuffer::output << g_render_stats.to_string() << std::endl;
+}
+/**
+ * @scripting
+ * @description Saves every ""interval""-th frame to ""screenshots/frameNNNNNN.png"", for example to compare gameplay recordings. 0 stops the recording.
+ * @param int $interval
+ */
+static void debug_record_frames(int interval)
+{
+  VideoSystem::current()->get_frame_capture().set_recording(interval);
+}
 /**
  * @scripting
  * @description Enables/disables drawing of non-solid layers.
@@ -843,6 +863,8 @@ void register_supertux_scripting_api(ssq::VM& vm)
   vm.addFunc("import", &scripting::Globals::import);
   vm.addFunc("debug_collrects", &scripting::Globals::debug_collrects);
   vm.addFunc("debug_show_fps", &scripting::Globals::debug_show_fps);
+  vm.addFunc("debug_render_stats", &scripting::Globals::debug_render_stats);
+  vm.addFunc("debug_record_frames", &scripting::Globals::debug_record_frames);
   vm.addFunc("debug_draw_solids_only", &scripting::Globals::debug_draw_solids_only);
   vm.addFunc("debug_draw_editor_images", &scripting::Globals::debug_draw_editor_images);
   vm.addFunc("debug_worldmap_ghost", &scripting::Globals::debug_worldmap_ghost);
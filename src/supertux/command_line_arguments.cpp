@@ -50,7 +50,8 @@ CommandLineArguments::CommandLineArguments() :
   christmas_mode(),
   repository_url(),
   editor(),
-  resave()
+  resave(),
+  render_shots()
 {
 }
 
@@ -97,6 +98,7 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("  --debug                      Print extra verbose messages") << "\n"
     << _("  --print-datadir              Print SuperTux's primary data directory.") << "\n"
     << _("  --acknowledgements           Print the licenses of libraries used by SuperTux.") << "\n"
+    << _("  --build-bundle FILE          Write the pre-parsed data files to FILE") << "\n"
     << "\n"
     << _("Video Options:") << "\n"
     << _("  -f, --fullscreen             Run in fullscreen mode") << "\n"
@@ -104,7 +106,7 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("  -g, --geometry WIDTHxHEIGHT  Run SuperTux in given resolution") << "\n"
     << _("  -a, --aspect WIDTH:HEIGHT    Run SuperTux with given aspect ratio") << "\n"
     << _("  -d, --default                Reset video settings to default values") << "\n"
-    << _("  --renderer RENDERER          Use sdl, opengl, or auto to render") << "\n"
+    << _("  --renderer RENDERER          Use sdl, opengl, offscreen or auto to render") << "\n"
     << "\n"
     << _("Audio Options:") << "\n"
     << _("  --disable-sound              Disable sound effects") << "\n"
@@ -113,6 +115,7 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("Game Options:") << "\n"
     << _("  --edit-level                 Open given level in editor") << "\n"
     << _("  --resave                     Loads given level and saves it") << "\n"
+    << _("  --render-shot X,Y            Render given level with the camera at X,Y, may be repeated") << "\n"
     << _("  --show-fps                   Display framerate in levels") << "\n"
     << _("  --no-show-fps                Do not display framerate in levels") << "\n"
     << _("  --show-pos                   Display player's current position") << "\n"
@@ -167,6 +170,18 @@ CommandLineArguments::parse_args(int argc, char** argv)
     {
       m_action = PRINT_ACKNOWLEDGEMENTS;
     }
+    else if (arg == "--build-bundle")
+    {
+      if (i + 1 >= argc)
+      {
+        throw std::runtime_error("Need to specify a file for --build-bundle");
+      }
+      else
+      {
+        m_action = BUILD_BUNDLE;
+        bundle_filename = argv[++i];
+      }
+    }
     else if (arg == "--debug")
     {
       m_log_level = LOG_DEBUG;
@@ -367,6 +382,18 @@ CommandLineArguments::parse_args(int argc, char** argv)
     {
       resave = true;
     }
+    else if (arg == "--render-shot")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("Need to specify a render-shot X,Y");
+      else
+      {
+        int x, y;
+        if (sscanf(argv[i], "%9d,%9d", &x, &y) != 2)
+          throw std::runtime_error("Invalid render-shot, should be X,Y");
+        render_shots.emplace_back(static_cast<float>(x), static_cast<float>(y));
+      }
+    }
     else if (arg[0] != '-')
     {
       filenames.push_back(arg);
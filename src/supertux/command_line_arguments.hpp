@@ -37,7 +37,8 @@ public:
     PRINT_VERSION,
     PRINT_HELP,
     PRINT_DATADIR,
-    PRINT_ACKNOWLEDGEMENTS
+    PRINT_ACKNOWLEDGEMENTS,
+    BUILD_BUNDLE
   };
 
 private:
@@ -80,6 +81,12 @@ public:
   std::optional<bool> editor;
   std::optional<bool> resave;
 
+  /** Camera positions to render the given level at */
+  std::vector<Vector> render_shots;
+
+  /** OS path to write the data bundle to, see ReaderBundle */
+  std::string bundle_filename;
+
   // std::optional<std::string> locale;
 
 public:
@@ -32,8 +32,10 @@ static const float FADE_SPEED = 1;
 
 ConsoleBuffer::ConsoleBuffer() :
   m_lines(),
+  m_head(0),
   m_console(nullptr)
 {
+  m_lines.reserve(BACKLOG_SIZE);
 }
 
 void
@@ -48,34 +50,50 @@ ConsoleBuffer::addLines(const std::string& s)
 }
 
 void
-ConsoleBuffer::addLine(const std::string& s_)
+ConsoleBuffer::addLine(const std::string& s)
 {
-  std::string s = s_;
-
   // Output line to stderr.
   get_logging_instance(false) << s << std::endl;
 
-  // Wrap long lines.
-  std::string overflow;
-  int line_count = 0;
-  do {
-    m_lines.push_front(Font::wrap_to_chars(s, 99, &overflow));
-    line_count += 1;
-    s = overflow;
-  } while (s.length() > 0);
-
-  // Trim scrollback buffer.
-  while (m_lines.size() >= 1000)
+  // Once the backlog is full, the oldest line gets overwritten.
+  if (m_lines.size() < BACKLOG_SIZE)
+  {
+    m_lines.push_back(Line{ s, {} });
+  }
+  else
   {
-    m_lines.pop_back();
+    Line& line = m_lines[m_head];
+    line.text = s;
+    line.wrapped.clear();
   }
+  m_head = (m_head + 1) % BACKLOG_SIZE;
 
   if (m_console)
   {
-    m_console->on_buffer_change(line_count);
+    // The console grows by the rows the line wraps into.
+    m_console->on_buffer_change(static_cast<int>(get_wrapped_line(0).size()));
   }
 }
 
+const std::vector<std::string>&
+ConsoleBuffer::get_wrapped_line(size_t age) const
+{
+  assert(age < m_lines.size());
+
+  const Line& line = m_lines[(m_head + BACKLOG_SIZE - 1 - age) % BACKLOG_SIZE];
+  if (line.wrapped.empty())
+  {
+    // Wrap long lines.
+    std::string s = line.text;
+    std::string overflow;
+    do {
+      line.wrapped.push_back(Font::wrap_to_chars(s, 99, &overflow));
+      s = overflow;
+    } while (s.length() > 0);
+  }
+  return line.wrapped;
+}
+
 void
 ConsoleBuffer::flush(ConsoleStreamBuffer& buffer)
 {
@@ -549,14 +567,24 @@ Console::draw(DrawingContext& context) const
     }
   }
 
+  // Only the lines that end up on screen get wrapped and drawn.
   int skipLines = -m_offset;
-  for (std::list<std::string>::iterator i = m_buffer.m_lines.begin(); i != m_buffer.m_lines.end(); ++i)
+  bool done = false;
+  for (size_t age = 0; age < m_buffer.get_line_count() && !done; ++age)
   {
-    if (skipLines-- > 0) continue;
-    lineNo++;
-    float py = static_cast<float>(m_height - 4.0f - static_cast<float>(lineNo) * m_font->get_height());
-    if (py < -m_font->get_height()) break;
-    context.color().draw_text(m_font, *i, Vector(4.0f, py), ALIGN_LEFT, layer);
+    const std::vector<std::string>& rows = m_buffer.get_wrapped_line(age);
+    for (auto row = rows.rbegin(); row != rows.rend(); ++row)
+    {
+      if (skipLines-- > 0) continue;
+      lineNo++;
+      float py = static_cast<float>(m_height - 4.0f - static_cast<float>(lineNo) * m_font->get_height());
+      if (py < -m_font->get_height())
+      {
+        done = true;
+        break;
+      }
+      context.color().draw_text(m_font, *row, Vector(4.0f, py), ALIGN_LEFT, layer);
+    }
   }
   context.pop_transform();
 }
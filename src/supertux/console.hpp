@@ -37,8 +37,20 @@ public:
   static std::ostream output; /**< stream of characters to output to the console. Do not forget to send std::endl or to flush the stream. */
   static ConsoleStreamBuffer s_outputBuffer; /**< stream buffer used by output stream */
 
+  static const size_t BACKLOG_SIZE = 1000; /**< number of lines kept in the backlog */
+
+private:
+  struct Line
+  {
+    std::string text;
+    mutable std::vector<std::string> wrapped; /**< text wrapped to the console width, filled on first display */
+  };
+
+private:
+  std::vector<Line> m_lines; /**< ring buffer of lines sent to the console, m_head is the slot written next */
+  size_t m_head;
+
 public:
-  std::list<std::string> m_lines; /**< backbuffer of lines sent to the console. New lines get added to front. */
   Console* m_console;
 
 public:
@@ -47,6 +59,11 @@ public:
   void addLines(const std::string& s); /**< display a string of (potentially) multiple lines in the console */
   void addLine(const std::string& s); /**< display a line in the console */
 
+  inline size_t get_line_count() const { return m_lines.size(); }
+
+  /** Returns the wrapped rows of a backlog line, age 0 being the most recent one */
+  const std::vector<std::string>& get_wrapped_line(size_t age) const;
+
   void flush(ConsoleStreamBuffer& buffer); /**< act upon changes in a ConsoleStreamBuffer */
 
   inline void set_console(Console* console)
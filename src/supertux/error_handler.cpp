@@ -31,6 +31,7 @@
 #include <version.h>
 
 #include "util/file_system.hpp"
+#include "util/log.hpp"
 
 #if (defined(__unix__) || defined(__APPLE__)) && !(defined(__EMSCRIPTEN__))
 #define UNIX
@@ -282,6 +283,7 @@ LONG WINAPI
 ErrorHandler::supertux_seh_handler(_EXCEPTION_POINTERS* ExceptionInfo)
 {
   pcontext = ExceptionInfo->ContextRecord;
+  log_flush_crash();
   error_dialog_crash(get_stacktrace());
   return EXCEPTION_EXECUTE_HANDLER;
 }
@@ -299,6 +301,10 @@ ErrorHandler::handle_error(int sig)
   {
     handling_error = true;
 
+    // The queued log lines usually lead up to the crash, write them
+    // without waiting for the writer thread, which may never run again.
+    log_flush_crash();
+
     // Do not use external stuff (like log_fatal) to limit the risk of causing
     // another error, which would restart the handler again.
     std::cerr << "\nError: signal " << sig << ":\n";
@@ -405,6 +411,8 @@ ErrorHandler::error_dialog_exception(const std::string& exception)
 
   std::string msg = stream.str();
 
+  // Get pending log output out first, it usually explains the error.
+  log_flush();
   std::cerr << msg << std::endl;
 
   SDL_MessageBoxButtonData btns[] = {
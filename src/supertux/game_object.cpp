@@ -24,9 +24,23 @@
 #include "editor/editor.hpp"
 #include "supertux/object_remove_listener.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/size_class_allocator.hpp"
 #include "util/writer.hpp"
+#include "math/vector.hpp"
 #include "video/color.hpp"
 
+namespace {
+
+SizeClassAllocator& get_allocator()
+{
+  // Never destroyed, so objects held by static objects can still be
+  // freed during shutdown.
+  static SizeClassAllocator* allocator = new SizeClassAllocator();
+  return *allocator;
+}
+
+} // namespace
+
 GameObject::GameObject(const std::string& name) :
   m_parent(),
   m_name(name),
@@ -58,6 +72,18 @@ GameObject::~GameObject()
   m_remove_listeners.clear();
 }
 
+void*
+GameObject::operator new(size_t size)
+{
+  return get_allocator().allocate(size);
+}
+
+void
+GameObject::operator delete(void* ptr, size_t size)
+{
+  get_allocator().deallocate(ptr, size);
+}
+
 void
 GameObject::add_remove_listener(ObjectRemoveListener* listener)
 {
@@ -93,6 +119,12 @@ GameObject::save()
   return save_stream.str();
 }
 
+Vector
+GameObject::get_interpolation_offset(float /*interpolation*/) const
+{
+  return Vector(0.0f, 0.0f);
+}
+
 GameObjectClasses
 GameObject::get_class_types() const
 {
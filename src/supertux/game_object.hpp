@@ -26,6 +26,7 @@
 #include <typeindex>
 
 #include "editor/object_settings.hpp"
+#include "math/fwd.hpp"
 #include "supertux/game_object_component.hpp"
 #include "util/fade_helper.hpp"
 #include "util/gettext.hpp"
@@ -92,6 +93,11 @@ public:
   GameObject(const ReaderMapping& reader);
   virtual ~GameObject() override;
 
+  /** GameObjects are taken from size-class pools, as effects like
+      explosions or coin bursts create and destroy them in bulk. */
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   /** Called after all objects have been added to the Sector and the
       Sector is fully constructed. If objects refer to other objects
       by name, those connection can be resolved here. */
@@ -110,6 +116,11 @@ public:
       DrawingContext if this function is called. */
   virtual void draw(DrawingContext& context) = 0;
 
+  /** Offset to draw the object at when only the given fraction of
+      the last game step should be shown, see
+      DrawingContext::get_interpolation(). */
+  virtual Vector get_interpolation_offset(float interpolation) const;
+
   /** This function saves the object. Editor will use that. */
   virtual void save(Writer& writer);
   std::string save();
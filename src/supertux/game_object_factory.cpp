@@ -140,6 +140,7 @@
 #include "object/weak_block.hpp"
 #include "object/wind.hpp"
 #include "supertux/level.hpp"
+#include "supertux/object_prototype.hpp"
 #include "supertux/tile_manager.hpp"
 #include "trigger/climbable.hpp"
 #include "trigger/door.hpp"
@@ -389,18 +390,7 @@ GameObjectFactory::create(const std::string& name, const std::string& data) cons
 std::unique_ptr<GameObject>
 GameObjectFactory::create(const std::string& name, const Vector& pos, const Direction& dir, const std::string& data) const
 {
-  std::stringstream lisptext;
-  lisptext << "(" << name << "\n"
-           << " (x " << pos.x << ")"
-           << " (y " << pos.y << ")" << data;
-  if (dir != Direction::AUTO) {
-    lisptext << " (direction \"" << dir << "\"))";
-  } else {
-    lisptext << ")";
-  }
-
-  auto doc = ReaderDocument::from_stream(lisptext);
-  return create(name, doc.get_root().get_mapping());
+  return ObjectPrototype(name, data).instantiate(pos, dir);
 }
 
 /* EOF */
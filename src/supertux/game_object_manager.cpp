@@ -19,6 +19,7 @@
 #include "supertux/game_object_manager.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 #include <simplesquirrel/class.hpp>
 #include <simplesquirrel/vm.hpp>
@@ -53,6 +54,8 @@ GameObjectManager::GameObjectManager(bool undo_tracking) :
   m_objects_by_name(),
   m_objects_by_uid(),
   m_objects_by_type_index(),
+  m_removed_objects(),
+  m_removed_types(),
   m_name_resolve_requests()
 {
 }
@@ -244,11 +247,26 @@ GameObjectManager::draw(DrawingContext& context)
     return;
   }
 
+  const float interpolation = context.get_interpolation();
+
   for (const auto& object : m_gameobjects)
   {
     if (!object->is_valid())
       continue;
 
+    if (interpolation < 1.0f)
+    {
+      const Vector offset = object->get_interpolation_offset(interpolation);
+      if (offset.x != 0.0f || offset.y != 0.0f)
+      {
+        context.push_transform();
+        context.set_translation(context.get_translation() - offset);
+        object->draw(context);
+        context.pop_transform();
+        continue;
+      }
+    }
+
     object->draw(context);
   }
 }
@@ -257,24 +275,55 @@ void
 GameObjectManager::flush_game_objects()
 {
   { // Clean up marked objects.
-    m_gameobjects.erase(
-      std::remove_if(m_gameobjects.begin(), m_gameobjects.end(),
-                     [this](const std::unique_ptr<GameObject>& obj) {
-                       if (!obj->is_valid())
-                       {
-                         this_before_object_remove(*obj);
-                         before_object_remove(*obj);
-                         return true;
-                       } else {
-                         return false;
-                       }
-                     }),
-      m_gameobjects.end());
+    // All of them are unregistered first, so that m_gameobjects and the
+    // per-type lists are compacted in one pass each, instead of being
+    // shifted once per object when many of them go away together.
+    // Objects that only become invalid during the hooks below are kept
+    // until the next flush, so that they get unregistered as well.
+    for (const auto& obj : m_gameobjects)
+    {
+      if (!obj->is_valid())
+        m_removed_objects.push_back(obj.get());
+    }
+
+    if (!m_removed_objects.empty())
+    {
+      for (GameObject* obj : m_removed_objects)
+      {
+        this_before_object_remove(*obj, false);
+        before_object_remove(*obj);
+      }
+
+      std::sort(m_removed_objects.begin(), m_removed_objects.end());
+      auto is_removed = [this](const GameObject* obj) {
+        return std::binary_search(m_removed_objects.begin(), m_removed_objects.end(), obj);
+      };
+
+      std::sort(m_removed_types.begin(), m_removed_types.end());
+      m_removed_types.erase(std::unique(m_removed_types.begin(), m_removed_types.end()),
+                            m_removed_types.end());
+
+      for (const std::type_index& type : m_removed_types)
+      {
+        auto& vec = m_objects_by_type_index[type];
+        vec.erase(std::remove_if(vec.begin(), vec.end(), is_removed), vec.end());
+      }
+      m_removed_types.clear();
+
+      m_gameobjects.erase(
+        std::remove_if(m_gameobjects.begin(), m_gameobjects.end(),
+                       [&is_removed](const std::unique_ptr<GameObject>& obj) {
+                         return is_removed(obj.get());
+                       }),
+        m_gameobjects.end());
+      m_removed_objects.clear();
+    }
   }
 
   { // Add newly created objects.
     // Objects might add new objects in finish_construction(), so we
     // loop until no new objects show up.
+    std::vector<std::unique_ptr<GameObject>> priority_objects;
     while (!m_gameobjects_new.empty()) {
       auto new_objects = std::move(m_gameobjects_new);
       for (auto& object : new_objects)
@@ -285,12 +334,19 @@ GameObjectManager::flush_game_objects()
           this_before_object_add(*object);
 
           if (object->has_object_manager_priority())
-            m_gameobjects.insert(m_gameobjects.begin(), std::move(object));
+            priority_objects.push_back(std::move(object));
           else
             m_gameobjects.push_back(std::move(object));
         }
       }
     }
+
+    // Prepend the priority objects in one go, the last one added ends
+    // up first, same as when inserting them one by one.
+    if (!priority_objects.empty())
+      m_gameobjects.insert(m_gameobjects.begin(),
+                           std::make_move_iterator(priority_objects.rbegin()),
+                           std::make_move_iterator(priority_objects.rend()));
   }
   update_tilemaps();
 
@@ -665,7 +721,7 @@ GameObjectManager::this_before_object_add(GameObject& object)
 }
 
 void
-GameObjectManager::this_before_object_remove(GameObject& object)
+GameObjectManager::this_before_object_remove(GameObject& object, bool update_type_index)
 {
   save_object_state(object, GameObjectChange::ACTION_DELETE);
 
@@ -684,6 +740,13 @@ GameObjectManager::this_before_object_remove(GameObject& object)
   { // By type index:
     for (const std::type_index& type : object.get_class_types().types)
     {
+      if (!update_type_index)
+      {
+        // Compacted by the caller once all objects are unregistered.
+        m_removed_types.push_back(type);
+        continue;
+      }
+
       auto& vec = m_objects_by_type_index[type];
       auto it = std::find(vec.begin(), vec.end(), &object);
       assert(it != vec.end());
@@ -332,7 +332,10 @@ private:
   void save_object_state(GameObject& object, GameObjectChange::Action action);
 
   void this_before_object_add(GameObject& object);
-  void this_before_object_remove(GameObject& object);
+  /** If 'update_type_index' is false, the object stays in
+      m_objects_by_type_index and its types are put into
+      m_removed_types instead. */
+  void this_before_object_remove(GameObject& object, bool update_type_index = true);
 
 protected:
   /** An initial flush_game_objects() call has been initiated. */
@@ -369,6 +372,14 @@ private:
   std::unordered_map<UID, GameObject*> m_objects_by_uid;
   std::unordered_map<std::type_index, std::vector<GameObject*> > m_objects_by_type_index;
 
+  /** Objects being removed by flush_game_objects(), kept as a member
+      to reuse its storage */
+  std::vector<GameObject*> m_removed_objects;
+
+  /** Types whose m_objects_by_type_index entries still contain removed
+      objects, kept as a member to reuse its storage */
+  std::vector<std::type_index> m_removed_types;
+
   std::vector<NameResolveRequest> m_name_resolve_requests;
 
 private:
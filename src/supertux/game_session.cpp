@@ -47,6 +47,7 @@
 #include "supertux/sector.hpp"
 #include "supertux/shrinkfade.hpp"
 #include "util/file_system.hpp"
+#include "util/reader_document.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
@@ -62,6 +63,7 @@ GameSession::GameSession(const std::string& levelfile_, Savegame& savegame, Stat
   reset_checkpoint_button(false),
   m_prevent_death(false),
   m_level(),
+  m_level_document(),
   m_statistics_backdrop(Surface::from_file("images/engine/menu/score-backdrop.png")),
   m_data_table(SquirrelVirtualMachine::current()->get_vm().findTable("Level").getOrCreateTable("data")),
   m_currentsector(nullptr),
@@ -191,7 +193,9 @@ GameSession::restart_level(bool after_death, bool preserve_music)
   }
 
   try {
-    m_level = LevelParser::from_file(m_levelfile, false, false);
+    if (!m_level_document)
+      m_level_document = std::make_unique<ReaderDocument>(LevelParser::read_document(m_levelfile));
+    m_level = LevelParser::from_document(*m_level_document, false, false);
 
     /* Determine the spawnpoint to spawn/respawn Tux to. */
     const GameSession::SpawnPoint* spawnpoint = nullptr;
@@ -450,6 +454,7 @@ GameSession::draw(Compositor& compositor)
 
   if (m_game_pause) {
     context.set_time_offset(0.0f);
+    context.set_interpolation(1.0f);
   }
 
   m_currentsector->draw(context);
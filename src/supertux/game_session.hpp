@@ -42,6 +42,7 @@ class DrawingContext;
 class EndSequence;
 class Level;
 class Player;
+class ReaderDocument;
 class Sector;
 class Statistics;
 class Savegame;
@@ -158,6 +159,11 @@ public:
 
 private:
   std::unique_ptr<Level> m_level;
+
+  /** Parsed contents of m_levelfile, kept around so that restarting
+      the level doesn't have to read and parse the file again */
+  std::unique_ptr<ReaderDocument> m_level_document;
+
   SurfacePtr m_statistics_backdrop;
 
   ssq::Table m_data_table;
@@ -54,7 +54,9 @@ Config::Config() :
 #endif
   video(VideoSystem::VIDEO_AUTO),
   vsync(1),
+  lightmap_downscale(5),
   frame_prediction(false),
+  frame_interpolation(false),
   show_fps(false),
   show_player_pos(false),
   show_controller(false),
@@ -144,6 +146,7 @@ Config::load()
 
   config_mapping.get("flash_intensity", flash_intensity);
   config_mapping.get("frame_prediction", frame_prediction);
+  config_mapping.get("frame_interpolation", frame_interpolation);
   config_mapping.get("show_fps", show_fps);
   config_mapping.get("show_player_pos", show_player_pos);
   config_mapping.get("show_controller", show_controller);
@@ -267,6 +270,7 @@ Config::load()
     config_video_mapping->get("video", video_string);
     video = VideoSystem::get_video_system(video_string);
     config_video_mapping->get("vsync", vsync);
+    config_video_mapping->get("lightmap_downscale", lightmap_downscale);
 
     config_video_mapping->get("fullscreen_width",  fullscreen_size.width);
     config_video_mapping->get("fullscreen_height", fullscreen_size.height);
@@ -365,6 +369,7 @@ Config::save()
   writer.write("profile", profile);
 
   writer.write("frame_prediction", frame_prediction);
+  writer.write("frame_interpolation", frame_interpolation);
   writer.write("show_fps", show_fps);
   writer.write("show_player_pos", show_player_pos);
   writer.write("show_controller", show_controller);
@@ -424,13 +429,14 @@ Config::save()
 
   writer.start_list("video");
   writer.write("fullscreen", use_fullscreen);
-  if (video == VideoSystem::VIDEO_NULL) {
-    // Avoid saving a NULL renderer to the configuration, as starting SuperTux without
-    // getting a window is rather confusing.
+  if (video == VideoSystem::VIDEO_NULL || video == VideoSystem::VIDEO_OFFSCREEN) {
+    // Avoid saving a NULL or offscreen renderer to the configuration, as starting
+    // SuperTux without getting a window is rather confusing.
   } else {
     writer.write("video", VideoSystem::get_video_string(video));
   }
   writer.write("vsync", vsync);
+  writer.write("lightmap_downscale", lightmap_downscale);
 
   writer.write("fullscreen_width",  fullscreen_size.width);
   writer.write("fullscreen_height", fullscreen_size.height);
@@ -511,6 +517,7 @@ void
 Config::check_values()
 {
   camera_peek_multiplier = math::clamp(camera_peek_multiplier, 0.f, 1.f);
+  lightmap_downscale = math::clamp(lightmap_downscale, 1, 16);
 }
 
 bool
@@ -69,7 +69,13 @@ public:
   bool use_fullscreen;
   VideoSystem::Enum video;
   int vsync;
+  /** The lightmap is rendered at 1/lightmap_downscale of the screen
+      resolution and upscaled with bilinear filtering. */
+  int lightmap_downscale;
   bool frame_prediction;
+  /** Draw moving objects and the camera between their last two
+      logical states instead of extrapolating them. */
+  bool frame_interpolation;
   bool show_fps;
   bool show_player_pos;
   bool show_controller;
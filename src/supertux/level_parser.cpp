@@ -65,10 +65,36 @@ LevelParser::from_stream(std::istream& stream, const std::string& context, bool
 
 std::unique_ptr<Level>
 LevelParser::from_file(const std::string& filename, bool worldmap, bool editable)
+{
+  return from_document(read_document(filename), worldmap, editable);
+}
+
+ReaderDocument
+LevelParser::read_document(const std::string& filename)
+{
+  register_translation_directory(filename);
+  try {
+    return ReaderDocument::from_file(filename);
+  } catch(std::exception& e) {
+    std::stringstream msg;
+    msg << "Problem when reading level '" << filename << "': " << e.what();
+    throw std::runtime_error(msg.str());
+  }
+}
+
+std::unique_ptr<Level>
+LevelParser::from_document(const ReaderDocument& doc, bool worldmap, bool editable)
 {
   auto level = std::make_unique<Level>(worldmap);
+  level->m_filename = doc.get_filename();
   LevelParser parser(*level, worldmap, editable);
-  parser.load(filename);
+  try {
+    parser.load(doc);
+  } catch(std::exception& e) {
+    std::stringstream msg;
+    msg << "Problem when reading level '" << doc.get_filename() << "': " << e.what();
+    throw std::runtime_error(msg.str());
+  }
   return level;
 }
 
@@ -129,21 +155,6 @@ LevelParser::load(std::istream& stream, const std::string& context)
   load(doc);
 }
 
-void
-LevelParser::load(const std::string& filepath)
-{
-  m_level.m_filename = filepath;
-  register_translation_directory(filepath);
-  try {
-    auto doc = ReaderDocument::from_file(filepath);
-    load(doc);
-  } catch(std::exception& e) {
-    std::stringstream msg;
-    msg << "Problem when reading level '" << filepath << "': " << e.what();
-    throw std::runtime_error(msg.str());
-  }
-}
-
 void
 LevelParser::load(const ReaderDocument& doc)
 {
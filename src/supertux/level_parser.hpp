@@ -29,6 +29,13 @@ class LevelParser final
 public:
   static std::unique_ptr<Level> from_stream(std::istream& stream, const std::string& context, bool worldmap, bool editable);
   static std::unique_ptr<Level> from_file(const std::string& filename, bool worldmap, bool editable);
+
+  /** Reads and parses a level file without instantiating it, the
+      result can be turned into a Level any number of times with
+      from_document(). */
+  static ReaderDocument read_document(const std::string& filename);
+  static std::unique_ptr<Level> from_document(const ReaderDocument& doc, bool worldmap, bool editable);
+
   static std::unique_ptr<Level> from_nothing(const std::string& basedir);
   static std::unique_ptr<Level> from_nothing_worldmap(const std::string& basedir, const std::string& name);
 
@@ -39,7 +46,6 @@ private:
 
   void load(const ReaderDocument& doc);
   void load(std::istream& stream, const std::string& context);
-  void load(const std::string& filepath);
   void load_old_format(const ReaderMapping& reader);
   void create(const std::string& filepath, const std::string& levelname);
 
@@ -18,6 +18,7 @@
 
 #include <config.h>
 #include <version.h>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 
@@ -47,8 +48,10 @@ extern "C" {
 #include "gui/menu_manager.hpp"
 #include "gui/notification.hpp"
 #include "math/random.hpp"
+#include "object/camera.hpp"
 #include "object/player.hpp"
 #include "object/spawnpoint.hpp"
+#include "physfs/ofile_stream.hpp"
 #include "physfs/physfs_file_system.hpp"
 #include "physfs/physfs_sdl.hpp"
 #include "physfs/util.hpp"
@@ -84,6 +87,8 @@ extern "C" {
 #include "util/string_util.hpp"
 #include "util/timelog.hpp"
 #include "util/string_util.hpp"
+#include "video/compositor.hpp"
+#include "video/render_stats.hpp"
 #include "video/sdl_surface.hpp"
 #include "video/sdl_surface_ptr.hpp"
 #include "video/ttf_surface_manager.hpp"
@@ -126,6 +131,7 @@ ConfigSubsystem::~ConfigSubsystem()
 Main::Main() :
   m_physfs_subsystem(),
   m_config_subsystem(),
+  m_reader_bundle(),
   m_sdl_subsystem(),
   m_console_buffer(),
   m_input_manager(),
@@ -134,6 +140,7 @@ Main::Main() :
   m_sound_manager(),
   m_squirrel_virtual_machine(),
   m_tile_manager(),
+  m_sprite_animation_system(),
   m_sprite_manager(),
   m_profile_manager(),
   m_resources(),
@@ -497,6 +504,57 @@ Main::resave(const std::string& input_filename, const std::string& output_filena
   Editor::s_resaving_in_progress = false;
 }
 
+void
+Main::render_shots(const std::string& filename, const std::vector<Vector>& positions)
+{
+  const std::string output_dir = "/render";
+  if (!PHYSFS_exists(output_dir.c_str()) && !PHYSFS_mkdir(output_dir.c_str())) {
+    log_fatal << "Creating '" << output_dir << "' failed" << std::endl;
+    return;
+  }
+
+  auto session = std::make_unique<GameSession>(filename, *m_savegame);
+  Sector& sector = session->get_current_sector();
+  Camera& camera = sector.get_camera();
+  camera.set_mode(Camera::Mode::MANUAL);
+
+  const std::string basename = FileSystem::strip_extension(filename);
+  OFileStream timings(FileSystem::join(output_dir, basename + "-timings.csv"));
+  timings << "shot,x,y,draw_ms,render_ms,draw_calls,texture_binds,vertices" << std::endl;
+
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    // Updating once lets the objects in view activate, the camera
+    // position gets clamped to the sector.
+    camera.set_translation(positions[i]);
+    sector.update(0.0f);
+
+    Compositor compositor(*m_video_system, 0.0f);
+
+    const auto start = std::chrono::steady_clock::now();
+    session->draw(compositor);
+    const auto drawn = std::chrono::steady_clock::now();
+    compositor.render();
+    const auto rendered = std::chrono::steady_clock::now();
+
+    const float draw_ms = std::chrono::duration<float, std::milli>(drawn - start).count();
+    const float render_ms = std::chrono::duration<float, std::milli>(rendered - drawn).count();
+    const RenderStats::Counters& counters = g_render_stats.get_last_frame();
+
+    const std::string image = FileSystem::join(output_dir, fmt::format("{}-{:03d}.png", basename, i));
+    SDLSurfacePtr surface = m_video_system->make_screenshot();
+    if (!surface || !SDLSurface::save_png(*surface, image)) {
+      log_warning << "Couldn't write " << image << std::endl;
+    }
+
+    timings << i << "," << positions[i].x << "," << positions[i].y << ","
+            << draw_ms << "," << render_ms << ","
+            << counters.draw_calls << "," << counters.texture_binds << "," << counters.vertices << std::endl;
+
+    log_info << image << ": draw " << draw_ms << " ms, render " << render_ms << " ms" << std::endl;
+  }
+}
+
 void
 Main::launch_game(const CommandLineArguments& args)
 {
@@ -507,6 +565,23 @@ Main::launch_game(const CommandLineArguments& args)
       so re-mount the directories, containing those files. */
   m_physfs_subsystem->remount_datadir_static();
 
+  if (PHYSFS_exists(ReaderBundle::FILENAME))
+  {
+    try
+    {
+      m_reader_bundle.reset(new ReaderBundle(ReaderBundle::FILENAME));
+    }
+    catch (const std::exception& err)
+    {
+      log_warning << "Couldn't load data bundle, parsing text files instead: " << err.what() << std::endl;
+    }
+  }
+
+  // Render shots are meant to work on machines without a display, e.g.
+  // CI, where initializing SDL's default video driver would fail.
+  if (!args.render_shots.empty() && !args.video)
+    SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+
   m_sdl_subsystem.reset(new SDLSubsystem());
   m_console_buffer.reset(new ConsoleBuffer());
 #ifdef ENABLE_TOUCHSCREEN_SUPPORT
@@ -529,6 +604,9 @@ Main::launch_game(const CommandLineArguments& args)
       video = VideoSystem::VIDEO_NULL;
     }
   }
+  else if (!args.render_shots.empty() && !args.video) {
+    video = VideoSystem::VIDEO_OFFSCREEN;
+  }
   s_timelog.log("video");
 
   m_video_system = VideoSystem::create(video);
@@ -552,6 +630,7 @@ Main::launch_game(const CommandLineArguments& args)
 
   s_timelog.log("resources");
   m_tile_manager.reset(new TileManager());
+  m_sprite_animation_system.reset(new SpriteAnimationSystem());
   m_sprite_manager.reset(new SpriteManager());
   m_profile_manager.reset(new ProfileManager());
   m_resources.reset(new Resources());
@@ -588,6 +667,10 @@ Main::launch_game(const CommandLineArguments& args)
       {
         resave(start_level, start_level);
       }
+      else if (!args.render_shots.empty())
+      {
+        render_shots(filename, args.render_shots);
+      }
       else if (args.editor)
       {
         if (PHYSFS_exists(start_level.c_str())) {
@@ -736,6 +819,10 @@ Main::run(int argc, char** argv)
         args.print_acknowledgements();
         return 0;
 
+      case CommandLineArguments::BUILD_BUNDLE:
+        ReaderBundle::build(args.bundle_filename);
+        return 0;
+
       default:
         launch_game(args);
         break;
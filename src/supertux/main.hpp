@@ -23,6 +23,7 @@
 #include "addon/addon_manager.hpp"
 #include "audio/sound_manager.hpp"
 #include "control/input_manager.hpp"
+#include "sprite/sprite_animation_system.hpp"
 #include "sprite/sprite_data.hpp"
 #include "sprite/sprite_manager.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
@@ -37,6 +38,7 @@
 #include "supertux/screen_manager.hpp"
 #include "supertux/tile_manager.hpp"
 #include "supertux/tile_set.hpp"
+#include "util/reader_bundle.hpp"
 #include "video/ttf_surface_manager.hpp"
 
 class ConfigSubsystem final
@@ -99,12 +101,17 @@ private:
 
   void launch_game(const CommandLineArguments& args);
   void resave(const std::string& input_filename, const std::string& output_filename);
+
+  /** Render the level with the camera at each of the given positions,
+      writing the images and the time spent on each frame to /render */
+  void render_shots(const std::string& filename, const std::vector<Vector>& positions);
   void release_check();
 
 private:
   // Using pointers allows us to initialize them whenever we want
   std::unique_ptr<PhysfsSubsystem> m_physfs_subsystem;
   std::unique_ptr<ConfigSubsystem> m_config_subsystem;
+  std::unique_ptr<ReaderBundle> m_reader_bundle;
   std::unique_ptr<SDLSubsystem> m_sdl_subsystem;
   std::unique_ptr<ConsoleBuffer> m_console_buffer;
   std::unique_ptr<InputManager> m_input_manager;
@@ -113,6 +120,7 @@ private:
   std::unique_ptr<SoundManager> m_sound_manager;
   std::unique_ptr<SquirrelVirtualMachine> m_squirrel_virtual_machine;
   std::unique_ptr<TileManager> m_tile_manager;
+  std::unique_ptr<SpriteAnimationSystem> m_sprite_animation_system;
   std::unique_ptr<SpriteManager> m_sprite_manager;
   std::unique_ptr<ProfileManager> m_profile_manager;
   std::unique_ptr<Resources> m_resources;
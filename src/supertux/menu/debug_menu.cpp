@@ -22,12 +22,15 @@
 #include "editor/editor.hpp"
 #include "gui/item_action.hpp"
 #include "gui/item_stringselect.hpp"
+#include "gui/item_toggle.hpp"
+#include "physfs/ofile_stream.hpp"
 #include "supertux/debug.hpp"
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
 #include "supertux/resources.hpp"
 #include "util/gettext.hpp"
 #include "util/log.hpp"
+#include "util/profiler.hpp"
 #include "video/texture_manager.hpp"
 
 DebugMenu::DebugMenu() :
@@ -75,12 +78,24 @@ DebugMenu::DebugMenu() :
              [](bool value){ g_debug.set_use_bitmap_fonts(value); });
   add_toggle(-1, _("Show Tile IDs in Editor Toolbox"), &g_debug.show_toolbox_tile_ids);
   add_toggle(-1, _("Hide Player HUD"), &g_debug.hide_player_hud);
+  add_toggle(-1, _("Show Profiler"),
+             []{ return g_profiler.is_enabled(); },
+             [](bool value){ g_profiler.set_enabled(value); })
+    .set_help(_("Shows the time spent in each part of the game loop."));
   
   add_entry(_("Reload Resources"), &Resources::reload_all)
     .set_help(_("Reloads all fonts, textures, sprites and tilesets."));
     
   add_entry(_("Dump Texture Cache"), []{ TextureManager::current()->debug_print(get_logging_instance()); });
 
+  add_entry(_("Export Profiler Trace"), []{
+      const std::string filename = "profiler_trace.json";
+      OFileStream out(filename);
+      g_profiler.write_chrome_trace(out);
+      log_info << "Wrote profiler trace to \"" << filename << "\"" << std::endl;
+    })
+    .set_help(_("Saves the recorded profiler frames in the Chrome trace format."));
+
   add_hl();
   add_back(_("Back"));
 }
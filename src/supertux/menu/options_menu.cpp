@@ -123,6 +123,9 @@ OptionsMenu::refresh()
       add_toggle(MNID_FRAME_PREDICTION, _("Frame prediction"), &g_config->frame_prediction)
         .set_help(_("Smooth camera motion, generating intermediate frames. This has a noticeable effect on monitors at >> 60Hz. Moving objects may be blurry."));
 
+      add_toggle(MNID_FRAME_INTERPOLATION, _("Frame interpolation"), &g_config->frame_interpolation)
+        .set_help(_("Smooth motion on monitors at >> 60Hz by drawing objects between their last two positions. Adds up to one game step of latency."));
+
       add_flash_intensity();
 
 #if !defined(HIDE_NONMOBILE_OPTIONS) && !defined(__EMSCRIPTEN__)
@@ -68,6 +68,7 @@ private:
     MNID_ASPECTRATIO,
     MNID_VSYNC,
     MNID_FRAME_PREDICTION,
+    MNID_FRAME_INTERPOLATION,
     MNID_SOUND,
     MNID_MUSIC,
     MNID_SOUND_VOLUME,
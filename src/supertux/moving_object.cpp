@@ -24,16 +24,28 @@
 #include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
 
+namespace {
+
+/** Objects moving further than this in a single step jumped rather
+    than moved and are drawn at their new position right away. */
+const float MAX_INTERPOLATION_DISTANCE = 64.0f;
+
+} // namespace
+
 MovingObject::MovingObject() :
   m_col(COLGROUP_MOVING, *this),
-  m_parent_dispenser()
+  m_parent_dispenser(),
+  m_last_pos(0.0f, 0.0f),
+  m_has_last_pos(false)
 {
 }
 
 MovingObject::MovingObject(const ReaderMapping& reader) :
   GameObject(reader),
   m_col(COLGROUP_MOVING, *this),
-  m_parent_dispenser()
+  m_parent_dispenser(),
+  m_last_pos(0.0f, 0.0f),
+  m_has_last_pos(false)
 {
   float height, width;
 
@@ -51,6 +63,21 @@ MovingObject::~MovingObject()
 {
 }
 
+Vector
+MovingObject::get_interpolation_offset(float interpolation) const
+{
+  if (!m_has_last_pos)
+    return Vector(0.0f, 0.0f);
+
+  const Vector movement = get_pos() - m_last_pos;
+
+  // Teleports, respawns and the like are not smeared over a step.
+  if (glm::length(movement) > MAX_INTERPOLATION_DISTANCE)
+    return Vector(0.0f, 0.0f);
+
+  return -movement * (1.0f - interpolation);
+}
+
 ObjectSettings
 MovingObject::get_settings()
 {
@@ -104,6 +104,16 @@ public:
     return &m_col;
   }
 
+  /** Remember the current position as the one to interpolate from,
+      called by the Sector before each game step. */
+  inline void save_last_pos()
+  {
+    m_last_pos = get_pos();
+    m_has_last_pos = true;
+  }
+
+  virtual Vector get_interpolation_offset(float interpolation) const override;
+
   void set_parent_dispenser(Dispenser* dispenser);
   inline Dispenser* get_parent_dispenser() const { return m_parent_dispenser; }
 
@@ -165,6 +175,10 @@ protected:
 
   Dispenser* m_parent_dispenser;
 
+private:
+  Vector m_last_pos;
+  bool m_has_last_pos;
+
 private:
   MovingObject(const MovingObject&) = delete;
   MovingObject& operator=(const MovingObject&) = delete;
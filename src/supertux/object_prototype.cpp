@@ -0,0 +1,85 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/object_prototype.hpp"
+
+#include <sstream>
+
+#include "supertux/game_object.hpp"
+#include "supertux/game_object_factory.hpp"
+#include "util/reader_mapping.hpp"
+
+namespace {
+
+ReaderDocument parse_object(const std::string& name, const std::string& data)
+{
+  std::stringstream lisptext;
+  lisptext << "(" << name << "\n" << data << ")";
+  return ReaderDocument::from_stream(lisptext);
+}
+
+} // namespace
+
+ObjectPrototype::ObjectPrototype(const std::string& name, const std::string& data) :
+  m_name(name),
+  m_doc(parse_object(name, data)),
+  m_placed(m_doc.get_sexp()),
+  m_has_direction(false)
+{
+  auto& arr = m_placed.as_array();
+  arr.insert(arr.begin() + 1, sexp::Value::array(sexp::Value::symbol("y"), sexp::Value::real(0.0f)));
+  arr.insert(arr.begin() + 1, sexp::Value::array(sexp::Value::symbol("x"), sexp::Value::real(0.0f)));
+}
+
+ObjectPrototype::ObjectPrototype(GameObject& object) :
+  ObjectPrototype(object.get_class_name(), object.save())
+{
+}
+
+std::unique_ptr<GameObject>
+ObjectPrototype::instantiate() const
+{
+  return GameObjectFactory::instance().create(m_name, m_doc.get_root().get_mapping());
+}
+
+std::unique_ptr<GameObject>
+ObjectPrototype::instantiate(const Vector& pos, const Direction& dir) const
+{
+  auto& arr = m_placed.as_array();
+  arr[1].as_array()[1] = sexp::Value::real(pos.x);
+  arr[2].as_array()[1] = sexp::Value::real(pos.y);
+
+  if (dir != Direction::AUTO)
+  {
+    auto direction = sexp::Value::array(sexp::Value::symbol("direction"),
+                                        sexp::Value::string(dir_to_string(dir)));
+    if (m_has_direction)
+      arr.back() = std::move(direction);
+    else
+      arr.push_back(std::move(direction));
+    m_has_direction = true;
+  }
+  else if (m_has_direction)
+  {
+    arr.pop_back();
+    m_has_direction = false;
+  }
+
+  return GameObjectFactory::instance().create(m_name, ReaderMapping(m_doc, m_placed));
+}
+
+/* EOF */
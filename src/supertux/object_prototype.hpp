@@ -0,0 +1,71 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_OBJECT_PROTOTYPE_HPP
+#define HEADER_SUPERTUX_SUPERTUX_OBJECT_PROTOTYPE_HPP
+
+#include <memory>
+#include <sexp/value.hpp>
+#include <string>
+
+#include "math/vector.hpp"
+#include "supertux/direction.hpp"
+#include "util/reader_document.hpp"
+
+class GameObject;
+
+/** A parsed description of a GameObject that can be instantiated any
+    number of times. The object data is parsed once on construction,
+    instantiating only patches the position and direction into the
+    already parsed tree, so no sexp text is formatted or parsed. */
+class ObjectPrototype final
+{
+public:
+  /** Parses the given object data, e.g. from a tile or a script */
+  ObjectPrototype(const std::string& name, const std::string& data);
+
+  /** Takes a snapshot of the current state of the given object */
+  explicit ObjectPrototype(GameObject& object);
+
+  /** Creates an exact copy of the prototype */
+  std::unique_ptr<GameObject> instantiate() const;
+
+  /** Creates a copy of the prototype at the given position. The
+      direction is only overridden if it isn't Direction::AUTO. */
+  std::unique_ptr<GameObject> instantiate(const Vector& pos, const Direction& dir = Direction::AUTO) const;
+
+  inline const std::string& get_name() const { return m_name; }
+
+private:
+  std::string m_name;
+  ReaderDocument m_doc;
+
+  /** Copy of the document's root with (x) and (y) in front and an
+      optional (direction) at the end, which take precedence over the
+      entries in the object data just like in
+      GameObjectFactory::create(). */
+  mutable sexp::Value m_placed;
+  mutable bool m_has_direction;
+
+private:
+  ObjectPrototype(const ObjectPrototype&) = delete;
+  ObjectPrototype& operator=(const ObjectPrototype&) = delete;
+};
+
+#endif
+
+/* EOF */
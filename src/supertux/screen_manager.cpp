@@ -26,6 +26,7 @@
 #include "gui/mousecursor.hpp"
 #include "object/player.hpp"
 #include "sdk/integration.hpp"
+#include "sprite/sprite_animation_system.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/console.hpp"
 #include "supertux/constants.hpp"
@@ -39,12 +40,17 @@
 #include "supertux/resources.hpp"
 #include "supertux/screen_fade.hpp"
 #include "supertux/sector.hpp"
+#include "util/allocation_counter.hpp"
 #include "util/log.hpp"
+#include "util/profiler.hpp"
+#include "video/color.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
+#include "video/render_stats.hpp"
 
 #include <stdio.h>
 #include <chrono>
+#include <functional>
 #include <iostream>
 
 #ifdef __EMSCRIPTEN__
@@ -141,6 +147,7 @@ ScreenManager::ScreenManager(VideoSystem& video_system, InputManager& input_mana
   elapsed_time(0.0f),
   seconds_per_step(1.0f / LOGICAL_FPS),
   m_fps_statistics(new FPS_Stats()),
+  m_frame_allocations(0),
   m_speed(1.0),
   m_actions(),
   m_screen_fade(),
@@ -228,6 +235,39 @@ ScreenManager::draw_fps(DrawingContext& context, FPS_Stats& fps_statistics)
   pos.x -= w2;
   context.color().draw_text(Resources::small_font, str1,
     pos, ALIGN_RIGHT, LAYER_HUD);
+
+  // Renderer statistics of the previous frame
+  const RenderStats::Counters& counters = g_render_stats.get_last_frame();
+  pos.x = context.get_width() - BORDER_X;
+  pos.y += 15;
+  snprintf(str1, str_length, "draws %d  binds %d  blends %d",
+    counters.draw_calls, counters.texture_binds, counters.blend_changes);
+  context.color().draw_text(Resources::small_font, str1,
+    pos, ALIGN_RIGHT, LAYER_HUD);
+  pos.y += 15;
+  snprintf(str1, str_length, "verts %d  upload %d KiB",
+    counters.vertices, static_cast<int>(counters.bytes_uploaded / 1024));
+  context.color().draw_text(Resources::small_font, str1,
+    pos, ALIGN_RIGHT, LAYER_HUD);
+
+  if (AllocationCounter::is_enabled())
+  {
+    pos.y += 15;
+    snprintf(str1, str_length, "allocs %d", static_cast<int>(m_frame_allocations));
+    context.color().draw_text(Resources::small_font, str1,
+      pos, ALIGN_RIGHT, LAYER_HUD);
+  }
+
+  const float gpu_screen_ms = g_render_stats.get_gpu_time(RenderStats::PASS_SCREEN);
+  if (gpu_screen_ms >= 0.0f)
+  {
+    pos.y += 15;
+    snprintf(str1, str_length, "GPU light %.2f  screen %.2f ms",
+      static_cast<double>(std::max(0.0f, g_render_stats.get_gpu_time(RenderStats::PASS_LIGHTMAP))),
+      static_cast<double>(gpu_screen_ms));
+    context.color().draw_text(Resources::small_font, str1,
+      pos, ALIGN_RIGHT, LAYER_HUD);
+  }
 }
 
 void
@@ -253,6 +293,66 @@ ScreenManager::draw_player_pos(DrawingContext& context)
   }
 }
 
+void
+ScreenManager::draw_profiler(DrawingContext& context)
+{
+  const Profiler::Frame* frame = g_profiler.get_last_frame();
+  if (!frame)
+    return;
+
+  const float row_height = 14.0f;
+  const Rectf graph_rect(BORDER_X, BORDER_Y + 100.0f,
+                         context.get_width() - BORDER_X, BORDER_Y + 100.0f + 6.0f * row_height);
+
+  // Scale the flame graph to the frame, but at least to a 60 FPS budget
+  // so that short frames don't look deceptively busy.
+  const float frame_ms = std::max(static_cast<float>(frame->duration_us) / 1000.0f, 1000.0f / 60.0f);
+  const float px_per_ms = graph_rect.get_width() / frame_ms;
+
+  context.color().draw_filled_rect(graph_rect, Color(0.0f, 0.0f, 0.0f, 0.5f), LAYER_HUD);
+
+  for (const auto& zone : frame->zones)
+  {
+    const float x = graph_rect.get_left() + static_cast<float>(zone.start_us) / 1000.0f * px_per_ms;
+    const float y = graph_rect.get_top() + static_cast<float>(zone.depth) * row_height;
+    const float width = std::max(1.0f, static_cast<float>(zone.duration_us) / 1000.0f * px_per_ms);
+    if (y + row_height > graph_rect.get_bottom())
+      continue;
+
+    // Derive a stable color from the zone name.
+    const size_t hash = std::hash<std::string>()(zone.name);
+    const Color color(0.4f + static_cast<float>(hash % 7) / 14.0f,
+                      0.4f + static_cast<float>((hash / 7) % 7) / 14.0f,
+                      0.3f, 0.8f);
+    const Rectf zone_rect(x, y, std::min(x + width, graph_rect.get_right()), y + row_height - 1.0f);
+    context.color().draw_filled_rect(zone_rect, color, LAYER_HUD + 1);
+
+    if (Resources::small_font->get_text_width(zone.name) < zone_rect.get_width())
+      context.color().draw_text(Resources::small_font, zone.name, Vector(x + 2.0f, y),
+                                ALIGN_LEFT, LAYER_HUD + 2, Color::BLACK);
+  }
+
+  // Per-zone histogram of the recent frames.
+  Vector pos(graph_rect.get_left(), graph_rect.get_bottom() + 4.0f);
+  char str[100];
+  snprintf(str, sizeof(str), "Frame %.2f ms   avg / max over %d frames",
+           static_cast<double>(frame->duration_us) / 1000.0, 60);
+  context.color().draw_text(Resources::small_font, str, pos, ALIGN_LEFT, LAYER_HUD);
+
+  for (const auto& stat : g_profiler.get_statistics(60))
+  {
+    pos.y += 15.0f;
+    if (AllocationCounter::is_enabled())
+      snprintf(str, sizeof(str), "%*s%s  %.2f / %.2f ms  %.1f allocs", stat.depth * 2, "", stat.name,
+               static_cast<double>(stat.avg_ms), static_cast<double>(stat.max_ms),
+               static_cast<double>(stat.avg_allocations));
+    else
+      snprintf(str, sizeof(str), "%*s%s  %.2f / %.2f ms", stat.depth * 2, "", stat.name,
+               static_cast<double>(stat.avg_ms), static_cast<double>(stat.max_ms));
+    context.color().draw_text(Resources::small_font, str, pos, ALIGN_LEFT, LAYER_HUD);
+  }
+}
+
 void
 ScreenManager::draw(Compositor& compositor, FPS_Stats& fps_statistics)
 {
@@ -285,6 +385,10 @@ ScreenManager::draw(Compositor& compositor, FPS_Stats& fps_statistics)
     draw_player_pos(context);
   }
 
+  if (g_profiler.is_enabled()) {
+    draw_profiler(context);
+  }
+
   // render everything
   compositor.render();
 }
@@ -292,6 +396,8 @@ ScreenManager::draw(Compositor& compositor, FPS_Stats& fps_statistics)
 void
 ScreenManager::update_gamelogic(float dt_sec)
 {
+  ProfileZone profile_zone("ScreenManager::update_gamelogic");
+
   Controller& controller = m_input_manager.get_controller();
 
   if (g_config->mobile_controls)
@@ -563,7 +669,8 @@ void ScreenManager::loop_iter()
     elapsed_time = 0;
   }
 
-  bool always_draw = g_debug.draw_redundant_frames || g_config->frame_prediction;
+  const bool interpolate = g_config->frame_interpolation;
+  bool always_draw = g_debug.draw_redundant_frames || g_config->frame_prediction || interpolate;
 
   if (elapsed_time < seconds_per_step && !always_draw) {
     // Sleep a bit because not enough time has passed since the previous
@@ -572,6 +679,10 @@ void ScreenManager::loop_iter()
     return;
   }
 
+  g_profiler.begin_frame();
+  ProfileZone profile_zone("ScreenManager::loop_iter");
+  const uint64_t allocations = AllocationCounter::get_count();
+
   // Useful if screens edit their status without switching screens
   Integration::update_status_all(m_screen_stack.back()->get_status());
   Integration::update_all();
@@ -619,10 +730,20 @@ void ScreenManager::loop_iter()
   // limit the draw time offset to at most one step.
   float time_offset = m_speed * speed_multiplier * std::min(elapsed_time, seconds_per_step);
 
+  // With interpolation the frame shows the state between the last two
+  // steps that corresponds to the time not yet consumed by the logic,
+  // so objects lag behind by at most one step instead of overshooting.
+  float interpolation = 1.0f;
+  if (interpolate)
+    interpolation = std::min(elapsed_time / seconds_per_step, 1.0f);
+
   if ((steps > 0 && !m_screen_stack.empty())
       || always_draw) {
     // Draw a frame
-    Compositor compositor(m_video_system, g_config->frame_prediction ? time_offset : 0.0f);
+    SpriteAnimationSystem::current()->update();
+    Compositor compositor(m_video_system,
+                          (g_config->frame_prediction && !interpolate) ? time_offset : 0.0f,
+                          interpolation);
     draw(compositor, *m_fps_statistics);
     m_fps_statistics->report_frame();
   }
@@ -631,6 +752,8 @@ void ScreenManager::loop_iter()
 
   handle_screen_switch();
 
+  m_frame_allocations = AllocationCounter::get_count() - allocations;
+
 #ifdef EMSCRIPTEN
   EM_ASM({
     supertux2_syncfs();
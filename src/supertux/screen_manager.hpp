@@ -68,6 +68,7 @@ private:
   struct FPS_Stats;
   void draw_fps(DrawingContext& context, FPS_Stats& fps_statistics);
   void draw_player_pos(DrawingContext& context);
+  void draw_profiler(DrawingContext& context);
   void draw(Compositor& compositor, FPS_Stats& fps_statistics);
   void update_gamelogic(float dt_sec);
   void process_events();
@@ -86,6 +87,9 @@ private:
   const float seconds_per_step;
   std::unique_ptr<FPS_Stats> m_fps_statistics;
 
+  /** Heap allocations made by the main thread during the previous frame */
+  uint64_t m_frame_allocations;
+
   float m_speed;
   struct Action
   {
@@ -49,13 +49,14 @@
 #include "supertux/colorscheme.hpp"
 #include "supertux/constants.hpp"
 #include "supertux/debug.hpp"
-#include "supertux/game_object_factory.hpp"
 #include "supertux/level.hpp"
+#include "supertux/object_prototype.hpp"
 #include "supertux/player_status_hud.hpp"
 #include "supertux/resources.hpp"
 #include "supertux/tile.hpp"
 #include "supertux/tile_manager.hpp"
 #include "util/file_system.hpp"
+#include "util/profiler.hpp"
 #include "util/writer.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
@@ -357,6 +358,8 @@ Sector::in_worldmap() const
 void
 Sector::update(float dt_sec)
 {
+  ProfileZone profile_zone("Sector::update");
+
   assert(m_initialized);
 
   BIND_SECTOR(*this);
@@ -367,6 +370,12 @@ Sector::update(float dt_sec)
   m_last_translation = camera.get_translation();
   m_last_dt = dt_sec;
 
+  if (g_config->frame_interpolation)
+  {
+    for (auto& object : get_objects_by_type<MovingObject>())
+      object.save_last_pos();
+  }
+
   m_squirrel_environment->update(dt_sec);
 
   GameObjectManager::update(dt_sec);
@@ -392,6 +401,9 @@ Sector::before_object_add(GameObject& object)
   if (auto* movingobject = dynamic_cast<MovingObject*>(&object))
   {
     m_collision_system->add(movingobject->get_collision_object());
+
+    if (auto* editor = Editor::current(); editor && Editor::is_active())
+      editor->on_object_add(*this, *movingobject);
   }
   else if (auto* tilemap = dynamic_cast<TileMap*>(&object))
   {
@@ -416,6 +428,9 @@ Sector::before_object_remove(GameObject& object)
   auto moving_object = dynamic_cast<MovingObject*>(&object);
   if (moving_object) {
     m_collision_system->remove(moving_object->get_collision_object());
+
+    if (auto* editor = Editor::current(); editor && Editor::is_active())
+      editor->on_object_remove(*this, *moving_object);
   }
 
   if (s_current == this)
@@ -484,7 +499,13 @@ Sector::draw(DrawingContext& context)
 
   Camera& camera = get_camera();
 
-  if (g_config->frame_prediction && m_last_dt > 0.f) {
+  if (context.get_interpolation() < 1.f && m_last_dt > 0.f) {
+    // Draw the camera between its last two states, in step with the
+    // interpolated objects (see GameObjectManager::draw()).
+    const float x = context.get_interpolation();
+    context.set_translation(camera.get_translation() * x + (1 - x) * m_last_translation);
+    context.scale(camera.get_current_scale() * x + (1 - x) * m_last_scale);
+  } else if (g_config->frame_prediction && m_last_dt > 0.f) {
     // Interpolate between two camera settings; there are many possible ways to do this, but on
     // short time scales all look about the same. This delays the camera position by one frame.
     // (The proper thing to do, of course, would be not to interpolate, but instead to adjust
@@ -695,7 +716,7 @@ Sector::change_solid_tiles(uint32_t old_tile_id, uint32_t new_tile_id)
 Player*
 Sector::get_nearest_player(const Vector& pos) const
 {
-  auto players = get_objects_by_type_index(typeid(Player));
+  const auto& players = get_objects_by_type_index(typeid(Player));
   if (players.size() == 1)
   {
     Player* player = static_cast<Player*>(players[0]);
@@ -821,7 +842,7 @@ Sector::convert_tiles2gameobject()
           {
             Vector pos = tm.get_tile_position(x, y) + tm_offset;
             try {
-              auto object = GameObjectFactory::instance().create(tile.get_object_name(), pos, Direction::AUTO, tile.get_object_data());
+              auto object = tile.get_object_prototype().instantiate(pos);
               add_object(std::move(object));
               tm.change(x, y, 0);
             } catch(std::exception& e) {
@@ -21,6 +21,7 @@
 #include "math/aatriangle.hpp"
 #include "supertux/constants.hpp"
 #include "supertux/globals.hpp"
+#include "supertux/object_prototype.hpp"
 #include "util/log.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
@@ -47,11 +48,14 @@ bool is_below_line (float l_x, float l_y, float m,
 Tile::Tile() :
   m_images(),
   m_editor_images(),
+  m_images_loader(),
+  m_editor_images_loader(),
   m_attributes(0),
   m_data(0),
   m_fps(1),
   m_object_name(),
   m_object_data(),
+  m_object_prototype(),
   m_deprecated(false)
 {
 }
@@ -64,18 +68,58 @@ Tile::Tile(const std::vector<SurfacePtr>& images,
            const std::string& obj_data) :
   m_images(images),
   m_editor_images(editor_images),
+  m_images_loader(),
+  m_editor_images_loader(),
   m_attributes(attributes),
   m_data(data),
   m_fps(fps),
   m_object_name(obj_name),
   m_object_data(obj_data),
+  m_object_prototype(),
   m_deprecated(deprecated)
 {
 }
 
+Tile::Tile(const SurfaceLoader& images_loader,
+           const SurfaceLoader& editor_images_loader,
+           uint32_t attributes, uint32_t data, float fps,
+           bool deprecated,
+           const std::string& obj_name,
+           const std::string& obj_data) :
+  m_images(),
+  m_editor_images(),
+  m_images_loader(images_loader),
+  m_editor_images_loader(editor_images_loader),
+  m_attributes(attributes),
+  m_data(data),
+  m_fps(fps),
+  m_object_name(obj_name),
+  m_object_data(obj_data),
+  m_object_prototype(),
+  m_deprecated(deprecated)
+{
+}
+
+Tile::~Tile()
+{
+}
+
+const ObjectPrototype&
+Tile::get_object_prototype() const
+{
+  if (!m_object_prototype)
+    m_object_prototype = std::make_unique<ObjectPrototype>(m_object_name, m_object_data);
+
+  return *m_object_prototype;
+}
+
 void
 Tile::draw(Canvas& canvas, const Vector& pos, int z_pos, const Color& color) const
 {
+  if (draw_editor_images) {
+    load_editor_images();
+  }
+
   if (draw_editor_images && m_editor_images.size() > 0) {
     size_t frame_no = 0;
     if (m_editor_images.size() > 1) {
@@ -85,6 +129,8 @@ Tile::draw(Canvas& canvas, const Vector& pos, int z_pos, const Color& color) con
     return;
   }
 
+  load_images();
+
   if(m_images.size() > 0)
   {
     size_t frame_no = 0;
@@ -208,6 +254,8 @@ Tile::draw_debug(Canvas& canvas, const Vector& pos, int z_pos, const Color& colo
 SurfacePtr
 Tile::get_current_surface() const
 {
+  load_images();
+
   if (m_images.size() > 1) {
     size_t frame = size_t(g_game_time * m_fps) % m_images.size();
     return m_images[frame];
@@ -221,6 +269,8 @@ Tile::get_current_surface() const
 SurfacePtr
 Tile::get_current_editor_surface() const
 {
+  load_editor_images();
+
   if (m_editor_images.size() > 1) {
     size_t frame = size_t(g_game_time * m_fps) % m_editor_images.size();
     return m_editor_images[frame];
@@ -231,6 +281,40 @@ Tile::get_current_editor_surface() const
   }
 }
 
+void
+Tile::load_images() const
+{
+  if (!m_images_loader)
+    return;
+
+  try
+  {
+    m_images = m_images_loader();
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't load tile images: " << err.what() << std::endl;
+  }
+  m_images_loader = nullptr;
+}
+
+void
+Tile::load_editor_images() const
+{
+  if (!m_editor_images_loader)
+    return;
+
+  try
+  {
+    m_editor_images = m_editor_images_loader();
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't load tile editor images: " << err.what() << std::endl;
+  }
+  m_editor_images_loader = nullptr;
+}
+
 // Check if the tile is solid given the current movement. This works
 // for south-slopes (which are solid when moving "down") and
 // north-slopes (which are solid when moving "up". "up" and "down" is
@@ -19,6 +19,8 @@
 #ifndef HEADER_SUPERTUX_SUPERTUX_TILE_HPP
 #define HEADER_SUPERTUX_SUPERTUX_TILE_HPP
 
+#include <functional>
+#include <memory>
 #include <vector>
 #include <stdint.h>
 
@@ -28,6 +30,7 @@
 
 class Canvas;
 class DrawingContext;
+class ObjectPrototype;
 
 class Tile final
 {
@@ -97,6 +100,11 @@ public:
     UNI_DIR_MASK  = 3
   };
 
+  /** Produces the surfaces of a tile, called when the tile is first
+      drawn so that tiles which never reach the screen are never
+      decoded or uploaded */
+  using SurfaceLoader = std::function<std::vector<SurfacePtr> ()>;
+
 public:
   Tile();
   Tile(const std::vector<SurfacePtr>& images,
@@ -104,6 +112,12 @@ public:
        uint32_t attributes, uint32_t data, float fps,
        bool deprecated = false,
        const std::string& obj_name = "", const std::string& obj_data = "");
+  Tile(const SurfaceLoader& images_loader,
+       const SurfaceLoader& editor_images_loader,
+       uint32_t attributes, uint32_t data, float fps,
+       bool deprecated = false,
+       const std::string& obj_name = "", const std::string& obj_data = "");
+  ~Tile();
 
   /** Draw a tile on the screen */
   void draw(Canvas& canvas, const Vector& pos, int z_pos, const Color& color = Color(1, 1, 1)) const;
@@ -145,6 +159,9 @@ public:
   inline const std::string& get_object_name() const { return m_object_name; }
   inline const std::string& get_object_data() const { return m_object_data; }
 
+  /** Returns the parsed object data, parsing it on first use */
+  const ObjectPrototype& get_object_prototype() const;
+
 private:
   /** Returns zero if a unisolid tile is non-solid due to the movement
       direction, non-zero if the tile is solid due to direction. */
@@ -155,9 +172,17 @@ private:
   bool check_position_unisolid (const Rectf& obj_bbox,
                                 const Rectf& tile_bbox) const;
 
+  /** Runs the pending surface loaders, if any */
+  void load_images() const;
+  void load_editor_images() const;
+
 private:
-  std::vector<SurfacePtr> m_images;
-  std::vector<SurfacePtr> m_editor_images;
+  mutable std::vector<SurfacePtr> m_images;
+  mutable std::vector<SurfacePtr> m_editor_images;
+
+  /** Reset once the surfaces have been created */
+  mutable SurfaceLoader m_images_loader;
+  mutable SurfaceLoader m_editor_images_loader;
 
   /** tile attributes */
   uint32_t m_attributes;
@@ -169,6 +194,7 @@ private:
 
   std::string m_object_name;
   std::string m_object_data;
+  mutable std::unique_ptr<ObjectPrototype> m_object_prototype;
 
   /** Prevent the addition of this tile to tilegroups, place restrictions in editor. */
   bool m_deprecated;
@@ -31,6 +31,17 @@
 #include "util/file_system.hpp"
 #include "video/surface.hpp"
 
+struct TileSetParser::ImageSpec
+{
+  std::string filename;
+  std::string tiles_path;
+  sexp::Value images;
+
+  /** Surfaces of a shared-surface (tiles ...) entry, created when the
+      first of its tiles is drawn */
+  std::optional<std::vector<SurfacePtr>> shared_surfaces;
+};
+
 TileSetParser::TileSetParser(TileSet& tileset, const std::string& filename,
                              int32_t start, int32_t end, int32_t offset) :
   m_tileset(tileset),
@@ -285,16 +296,16 @@ TileSetParser::parse_tile(const ReaderMapping& reader)
     attributes |= Tile::SOLID | Tile::SLOPE;
   }
 
-  std::vector<SurfacePtr> editor_surfaces;
+  Tile::SurfaceLoader editor_surfaces;
   std::optional<ReaderMapping> editor_images_mapping;
   if (reader.get("editor-images", editor_images_mapping)) {
-    editor_surfaces = parse_imagespecs(*editor_images_mapping);
+    editor_surfaces = make_loader(make_image_spec(*editor_images_mapping));
   }
 
-  std::vector<SurfacePtr> surfaces;
+  Tile::SurfaceLoader surfaces;
   std::optional<ReaderMapping> images_mapping;
   if (reader.get("images", images_mapping)) {
-    surfaces = parse_imagespecs(*images_mapping);
+    surfaces = make_loader(make_image_spec(*images_mapping));
   }
 
   bool deprecated = false;
@@ -386,93 +397,88 @@ TileSetParser::parse_tiles(const ReaderMapping& reader)
   }
   else
   {
-    if (shared_surface)
-    {
-      std::vector<SurfacePtr> editor_surfaces;
-      std::optional<ReaderMapping> editor_surfaces_mapping;
-      if (reader.get("editor-images", editor_surfaces_mapping)) {
-        editor_surfaces = parse_imagespecs(*editor_surfaces_mapping);
-      }
-
-      std::vector<SurfacePtr> surfaces;
-      std::optional<ReaderMapping> surfaces_mapping;
-      if (reader.get("image", surfaces_mapping) ||
-         reader.get("images", surfaces_mapping)) {
-        surfaces = parse_imagespecs(*surfaces_mapping);
-      }
+    std::shared_ptr<ImageSpec> editor_spec;
+    std::optional<ReaderMapping> editor_surfaces_mapping;
+    if (reader.get("editor-images", editor_surfaces_mapping)) {
+      editor_spec = make_image_spec(*editor_surfaces_mapping);
+    }
 
-      for (size_t i = 0; i < ids.size(); ++i)
-      {
-        if (!ids[i] || (ids[i] < static_cast<uint32_t>(m_start) || (m_end && ids[i] > static_cast<uint32_t>(m_end)))) continue;
-        ids[i] += m_offset + tiles_offset;
-
-        const int x = static_cast<int>(32 * (i % width));
-        const int y = static_cast<int>(32 * (i / width));
-
-        std::vector<SurfacePtr> regions;
-        regions.reserve(surfaces.size());
-        std::transform(surfaces.begin(), surfaces.end(), std::back_inserter(regions),
-            [x, y] (const SurfacePtr& surface) { 
-              return surface->region(Rect(x, y, Size(32, 32)));
-            });
-
-        std::vector<SurfacePtr> editor_regions;
-        editor_regions.reserve(editor_surfaces.size());
-        std::transform(editor_surfaces.begin(), editor_surfaces.end(), std::back_inserter(editor_regions),
-            [x, y] (const SurfacePtr& surface) { 
-              return surface->region(Rect(x, y, Size(32, 32)));
-            });
-
-        auto tile = std::make_unique<Tile>(regions,
-                                           editor_regions,
-                                           (has_attributes ? attributes[i] : 0),
-                                           (has_datas ? datas[i] : 0),
-                                           fps, deprecated);
-
-        m_tileset.add_tile(ids[i], std::move(tile));
-      }
+    std::shared_ptr<ImageSpec> spec;
+    std::optional<ReaderMapping> surfaces_mapping;
+    if (reader.get("image", surfaces_mapping) ||
+       reader.get("images", surfaces_mapping)) {
+      spec = make_image_spec(*surfaces_mapping);
     }
-    else // (!shared_surface)
+
+    for (size_t i = 0; i < ids.size(); ++i)
     {
-      for (size_t i = 0; i < ids.size(); ++i)
-      {
-        if(!ids[i] || (ids[i] < static_cast<uint32_t>(m_start) || (m_end && ids[i] > static_cast<uint32_t>(m_end)))) continue;
-        ids[i] += m_offset + tiles_offset;
+      if (!ids[i] || (ids[i] < static_cast<uint32_t>(m_start) || (m_end && ids[i] > static_cast<uint32_t>(m_end)))) continue;
+      ids[i] += m_offset + tiles_offset;
+
+      const int x = static_cast<int>(32 * (i % width));
+      const int y = static_cast<int>(32 * (i / width));
+      const Rect region(x, y, Size(32, 32));
+
+      // With a shared surface the images are loaded once and each tile
+      // is a region of them, otherwise every tile loads its own region.
+      auto tile = std::make_unique<Tile>(shared_surface ? make_shared_loader(spec, region) : make_loader(spec, region),
+                                         shared_surface ? make_shared_loader(editor_spec, region) : make_loader(editor_spec, region),
+                                         (has_attributes ? attributes[i] : 0),
+                                         (has_datas ? datas[i] : 0),
+                                         fps, deprecated);
+
+      m_tileset.add_tile(ids[i], std::move(tile));
+    }
+  }
+}
 
-        int x = static_cast<int>(32 * (i % width));
-        int y = static_cast<int>(32 * (i / width));
+std::shared_ptr<TileSetParser::ImageSpec>
+TileSetParser::make_image_spec(const ReaderMapping& images_mapping) const
+{
+  return std::make_shared<ImageSpec>(ImageSpec{ m_filename, m_tiles_path, images_mapping.get_sexp(), std::nullopt });
+}
 
-        std::vector<SurfacePtr> surfaces;
-        std::optional<ReaderMapping> surfaces_mapping;
-        if (reader.get("image", surfaces_mapping) ||
-           reader.get("images", surfaces_mapping)) {
-          surfaces = parse_imagespecs(*surfaces_mapping, Rect(x, y, Size(32, 32)));
-        }
+Tile::SurfaceLoader
+TileSetParser::make_loader(const std::shared_ptr<ImageSpec>& spec, const std::optional<Rect>& region)
+{
+  if (!spec)
+    return {};
 
-        std::vector<SurfacePtr> editor_surfaces;
-        std::optional<ReaderMapping> editor_surfaces_mapping;
-        if (reader.get("editor-images", editor_surfaces_mapping)) {
-          editor_surfaces = parse_imagespecs(*editor_surfaces_mapping, Rect(x, y, Size(32, 32)));
-        }
+  return [spec, region] {
+    return parse_imagespecs(*spec, region);
+  };
+}
 
-        auto tile = std::make_unique<Tile>(surfaces,
-                                           editor_surfaces,
-                                           (has_attributes ? attributes[i] : 0),
-                                           (has_datas ? datas[i] : 0),
-                                           fps, deprecated);
+Tile::SurfaceLoader
+TileSetParser::make_shared_loader(const std::shared_ptr<ImageSpec>& spec, const Rect& region)
+{
+  if (!spec)
+    return {};
 
-        m_tileset.add_tile(ids[i], std::move(tile));
-      }
+  return [spec, region] {
+    if (!spec->shared_surfaces) {
+      spec->shared_surfaces = parse_imagespecs(*spec);
     }
-  }
+
+    std::vector<SurfacePtr> regions;
+    regions.reserve(spec->shared_surfaces->size());
+    std::transform(spec->shared_surfaces->begin(), spec->shared_surfaces->end(), std::back_inserter(regions),
+        [&region] (const SurfacePtr& surface) {
+          return surface->region(region);
+        });
+    return regions;
+  };
 }
 
 std::vector<SurfacePtr>
-  TileSetParser::parse_imagespecs(const ReaderMapping& images_mapping,
-                                  const std::optional<Rect>& surface_region) const
+TileSetParser::parse_imagespecs(const ImageSpec& spec,
+                                const std::optional<Rect>& surface_region)
 {
   std::vector<SurfacePtr> surfaces;
 
+  const ReaderDocument doc(spec.filename, spec.images);
+  const ReaderMapping images_mapping(doc, spec.images);
+
   // (images "foo.png" "foo.bar" ...)
   // (images (region "foo.png" 0 0 32 32))
   auto iter = images_mapping.get_iter();
@@ -481,7 +487,7 @@ std::vector<SurfacePtr>
     if (iter.is_string())
     {
       std::string file = iter.as_string_item();
-      surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file), surface_region));
+      surfaces.push_back(Surface::from_file(FileSystem::join(spec.tiles_path, file), surface_region));
     }
     else if (iter.is_pair() && iter.get_key() == "surface")
     {
@@ -514,7 +520,7 @@ std::vector<SurfacePtr>
           rect.bottom = rect.top + surface_region->get_height();
         }
 
-        surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file),
+        surfaces.push_back(Surface::from_file(FileSystem::join(spec.tiles_path, file),
                                               rect));
       }
     }
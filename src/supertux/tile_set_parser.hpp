@@ -18,9 +18,10 @@
 #ifndef HEADER_SUPERTUX_SUPERTUX_TILE_SET_PARSER_HPP
 #define HEADER_SUPERTUX_SUPERTUX_TILE_SET_PARSER_HPP
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
-#include <optional>
 
 #include "math/rect.hpp"
 #include "supertux/tile.hpp"
@@ -30,6 +31,9 @@ class TileSet;
 
 class TileSetParser final
 {
+private:
+  struct ImageSpec;
+
 private:
   TileSet&    m_tileset;
   std::string m_filename;
@@ -48,8 +52,16 @@ public:
 private:
   void parse_tile(const ReaderMapping& reader);
   void parse_tiles(const ReaderMapping& reader);
-  std::vector<SurfacePtr> parse_imagespecs(const ReaderMapping& cur,
-                                           const std::optional<Rect>& region = std::nullopt) const;
+
+  /** Keeps a copy of an (images ...) entry so that its surfaces can be
+      created once the tile is first drawn. */
+  std::shared_ptr<ImageSpec> make_image_spec(const ReaderMapping& images_mapping) const;
+  static Tile::SurfaceLoader make_loader(const std::shared_ptr<ImageSpec>& spec,
+                                         const std::optional<Rect>& region = std::nullopt);
+  static Tile::SurfaceLoader make_shared_loader(const std::shared_ptr<ImageSpec>& spec, const Rect& region);
+
+  static std::vector<SurfacePtr> parse_imagespecs(const ImageSpec& spec,
+                                                  const std::optional<Rect>& region = std::nullopt);
 
 private:
   TileSetParser(const TileSetParser&) = delete;
@@ -0,0 +1,88 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/allocation_counter.hpp"
+
+#include <config.h>
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+
+#include <new>
+#include <stdlib.h>
+
+namespace {
+
+// Constant-initialized, so it is safe to use from allocations made
+// before or during the initialization of other statics.
+thread_local uint64_t s_allocation_count = 0;
+
+} // namespace
+
+void* operator new(size_t size)
+{
+  ++s_allocation_count;
+
+  if (size == 0)
+    size = 1;
+
+  while (true)
+  {
+    if (void* ptr = malloc(size))
+      return ptr;
+
+    std::new_handler handler = std::get_new_handler();
+    if (!handler)
+      throw std::bad_alloc();
+    handler();
+  }
+}
+
+// The array, nothrow and sized variants forward to these two.
+void operator delete(void* ptr) noexcept
+{
+  free(ptr);
+}
+
+bool
+AllocationCounter::is_enabled()
+{
+  return true;
+}
+
+uint64_t
+AllocationCounter::get_count()
+{
+  return s_allocation_count;
+}
+
+#else
+
+bool
+AllocationCounter::is_enabled()
+{
+  return false;
+}
+
+uint64_t
+AllocationCounter::get_count()
+{
+  return 0;
+}
+
+#endif
+
+/* EOF */
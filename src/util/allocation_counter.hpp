@@ -0,0 +1,42 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_ALLOCATION_COUNTER_HPP
+#define HEADER_SUPERTUX_UTIL_ALLOCATION_COUNTER_HPP
+
+#include <stdint.h>
+
+/** Counts the heap allocations made through operator new, separately
+    for each thread. The counting operator new is only compiled in
+    when building with ENABLE_ALLOCATION_TRACKING, otherwise the count
+    always stays zero. */
+class AllocationCounter final
+{
+public:
+  static bool is_enabled();
+
+  /** Number of allocations made by the calling thread so far */
+  static uint64_t get_count();
+
+private:
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -0,0 +1,82 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/block_pool.hpp"
+
+#include <algorithm>
+#include <assert.h>
+
+namespace {
+
+size_t round_block_size(size_t size)
+{
+  const size_t align = alignof(std::max_align_t);
+  size = std::max(size, sizeof(void*));
+  return (size + align - 1) / align * align;
+}
+
+} // namespace
+
+BlockPool::BlockPool(size_t block_size, size_t chunk_size) :
+  m_block_size(round_block_size(block_size)),
+  m_chunk_size(std::max(chunk_size, static_cast<size_t>(1))),
+  m_chunks(),
+  m_free(nullptr),
+  m_used(0)
+{
+}
+
+void*
+BlockPool::allocate()
+{
+  if (!m_free)
+    grow();
+
+  void* block = m_free;
+  m_free = *static_cast<void**>(block);
+  m_used += 1;
+  return block;
+}
+
+void
+BlockPool::deallocate(void* ptr)
+{
+  if (!ptr)
+    return;
+
+  assert(m_used > 0);
+  *static_cast<void**>(ptr) = m_free;
+  m_free = ptr;
+  m_used -= 1;
+}
+
+void
+BlockPool::grow()
+{
+  m_chunks.emplace_back(new unsigned char[m_block_size * m_chunk_size]);
+
+  // Thread the new blocks onto the free list, lowest address first.
+  unsigned char* chunk = m_chunks.back().get();
+  for (size_t i = m_chunk_size; i > 0; --i)
+  {
+    void* block = chunk + (i - 1) * m_block_size;
+    *static_cast<void**>(block) = m_free;
+    m_free = block;
+  }
+}
+
+/* EOF */
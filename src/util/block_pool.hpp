@@ -0,0 +1,67 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_BLOCK_POOL_HPP
+#define HEADER_SUPERTUX_UTIL_BLOCK_POOL_HPP
+
+#include <memory>
+#include <cstddef>
+#include <vector>
+
+/** Hands out fixed-size blocks of memory. Memory is taken from the
+    heap in chunks of several blocks, freed blocks are put on a free
+    list and reused by the next allocation, so objects that are created
+    and destroyed all the time don't cause any heap traffic once the
+    pool has grown large enough. Chunks are only given back when the
+    pool itself is destroyed.
+
+    Blocks are aligned for any fundamental type. The pool is not
+    thread-safe. */
+class BlockPool final
+{
+public:
+  BlockPool(size_t block_size, size_t chunk_size = 64);
+
+  void* allocate();
+  void deallocate(void* ptr);
+
+  inline size_t get_block_size() const { return m_block_size; }
+
+  /** Number of blocks currently handed out */
+  inline size_t get_used() const { return m_used; }
+
+  /** Number of blocks the pool has taken from the heap */
+  inline size_t get_capacity() const { return m_chunks.size() * m_chunk_size; }
+
+private:
+  void grow();
+
+private:
+  const size_t m_block_size;
+  const size_t m_chunk_size;
+  std::vector<std::unique_ptr<unsigned char[]> > m_chunks;
+  void* m_free;
+  size_t m_used;
+
+private:
+  BlockPool(const BlockPool&) = delete;
+  BlockPool& operator=(const BlockPool&) = delete;
+};
+
+#endif
+
+/* EOF */
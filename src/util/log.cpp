@@ -17,7 +17,11 @@
 
 #include "util/log.hpp"
 
+#include <SDL.h>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 #ifdef __ANDROID__
 #include <android/log.h>
 #endif
@@ -95,6 +99,249 @@ class _android_debugbuf: public std::streambuf
 };
 
 static std::ostream android_logcat(new _android_debugbuf());
+#else
+
+namespace {
+
+/** Number of identical lines after which a repeat notice is written
+    even if no other line came in between. */
+const int REPEAT_REPORT_INTERVAL = 1000;
+
+/** Lines queued beyond this are dropped instead of growing the queue
+    without bound while the terminal can't keep up. */
+const size_t MAX_PENDING_LINES = 10000;
+
+/** Set once the writer is gone, later log output goes straight to
+    stderr. */
+bool s_log_writer_closed = false;
+
+/** Stream buffer for stderr that hands completed log lines over to a
+    background thread, so that a slow terminal never stalls the game
+    loop. The producer only holds the lock to append to the queue,
+    the writer takes the whole batch at once.
+
+    Runs of identical lines, e.g. a warning issued every frame, are
+    collapsed into a single line and a repeat count. */
+class LogWriter final : public std::stringbuf
+{
+public:
+  LogWriter() :
+    m_stream(this),
+    m_thread(nullptr),
+    m_mutex(SDL_CreateMutex()),
+    m_cond(SDL_CreateCond()),
+    m_idle_cond(SDL_CreateCond()),
+    m_queue(),
+    m_writing(false),
+    m_quit(false),
+    m_dropped(0),
+    m_last_line(),
+    m_repeat_count(0)
+  {
+    if (m_mutex && m_cond && m_idle_cond)
+      m_thread = SDL_CreateThread(&LogWriter::writer_main, "LogWriter", this);
+  }
+
+  ~LogWriter() override
+  {
+    pubsync();
+    flush_repeats();
+
+    if (m_thread)
+    {
+      SDL_LockMutex(m_mutex);
+      m_quit = true;
+      SDL_CondSignal(m_cond);
+      SDL_UnlockMutex(m_mutex);
+
+      // The writer empties the queue before it returns.
+      SDL_WaitThread(m_thread, nullptr);
+    }
+
+    if (m_idle_cond)
+      SDL_DestroyCond(m_idle_cond);
+    if (m_cond)
+      SDL_DestroyCond(m_cond);
+    if (m_mutex)
+      SDL_DestroyMutex(m_mutex);
+
+    s_log_writer_closed = true;
+  }
+
+  inline std::ostream& get_stream() { return m_stream; }
+
+  void flush()
+  {
+    pubsync();
+    flush_repeats();
+
+    if (!m_thread)
+      return;
+
+    SDL_LockMutex(m_mutex);
+    while (!m_queue.empty() || m_writing)
+      SDL_CondWait(m_idle_cond, m_mutex);
+    SDL_UnlockMutex(m_mutex);
+  }
+
+  /** Variant of flush() for the crash handler, which writes the queued
+      lines itself and never waits, as the lock might be held by the
+      thread that crashed. A batch the writer is busy with at that
+      moment may end up after the lines written here. */
+  void drain()
+  {
+    std::vector<std::string> batch;
+    int dropped = 0;
+    if (m_thread && SDL_TryLockMutex(m_mutex) == 0)
+    {
+      batch.swap(m_queue);
+      dropped = m_dropped;
+      m_dropped = 0;
+      SDL_UnlockMutex(m_mutex);
+    }
+
+    for (const auto& text : batch)
+      std::cerr << text;
+    if (dropped > 0)
+      std::cerr << "[" << dropped << " log messages dropped]\n";
+    if (m_repeat_count > 0)
+      std::cerr << "[last message repeated " << m_repeat_count << " times]\n";
+
+    // A line that was still being composed when the crash happened.
+    std::cerr << str() << std::flush;
+  }
+
+protected:
+  virtual int sync() override
+  {
+    std::string text = str();
+    if (!text.empty())
+    {
+      str("");
+      push_line(std::move(text));
+    }
+    return 0;
+  }
+
+private:
+  void push_line(std::string line)
+  {
+    if (line == m_last_line)
+    {
+      m_repeat_count += 1;
+      if (m_repeat_count >= REPEAT_REPORT_INTERVAL)
+        flush_repeats();
+      return;
+    }
+
+    flush_repeats();
+    m_last_line = line;
+    push(std::move(line));
+  }
+
+  void flush_repeats()
+  {
+    if (m_repeat_count == 0)
+      return;
+
+    std::ostringstream out;
+    out << "[last message repeated " << m_repeat_count << " times]\n";
+    m_repeat_count = 0;
+    push(out.str());
+  }
+
+  void push(std::string text)
+  {
+    if (!m_thread)
+    {
+      std::cerr << text << std::flush;
+      return;
+    }
+
+    SDL_LockMutex(m_mutex);
+    if (m_queue.size() < MAX_PENDING_LINES)
+    {
+      m_queue.push_back(std::move(text));
+      SDL_CondSignal(m_cond);
+    }
+    else
+    {
+      m_dropped += 1;
+    }
+    SDL_UnlockMutex(m_mutex);
+  }
+
+  static int writer_main(void* data)
+  {
+    static_cast<LogWriter*>(data)->run_writer();
+    return 0;
+  }
+
+  void run_writer()
+  {
+    std::vector<std::string> batch;
+
+    SDL_LockMutex(m_mutex);
+    while (true)
+    {
+      while (m_queue.empty() && !m_quit)
+        SDL_CondWait(m_cond, m_mutex);
+
+      if (m_queue.empty())
+        break;
+
+      batch.swap(m_queue);
+      int dropped = m_dropped;
+      m_dropped = 0;
+      m_writing = true;
+      SDL_UnlockMutex(m_mutex);
+
+      for (const auto& text : batch)
+        std::cerr << text;
+      if (dropped > 0)
+        std::cerr << "[" << dropped << " log messages dropped]\n";
+      std::cerr << std::flush;
+      batch.clear();
+
+      SDL_LockMutex(m_mutex);
+      m_writing = false;
+      SDL_CondBroadcast(m_idle_cond);
+    }
+    SDL_UnlockMutex(m_mutex);
+  }
+
+private:
+  std::ostream m_stream;
+
+  SDL_Thread* m_thread;
+  SDL_mutex* m_mutex;
+  SDL_cond* m_cond;
+  SDL_cond* m_idle_cond;
+
+  std::vector<std::string> m_queue;
+  bool m_writing;
+  bool m_quit;
+  int m_dropped;
+
+  /** Not touched by the writer thread. */
+  std::string m_last_line;
+  int m_repeat_count;
+
+private:
+  LogWriter(const LogWriter&) = delete;
+  LogWriter& operator=(const LogWriter&) = delete;
+};
+
+LogWriter& get_log_writer()
+{
+  // Constructed on first use, as static constructors elsewhere might
+  // already log.
+  static LogWriter writer;
+  return writer;
+}
+
+} // namespace
+
 #endif
 
 LogLevel g_log_level = LOG_WARNING;
@@ -107,7 +354,27 @@ std::ostream& get_logging_instance(bool use_console_buffer)
 #ifdef __ANDROID__
     return android_logcat;
 #else
-    return (std::cerr);
+  {
+    if (s_log_writer_closed)
+      return (std::cerr);
+    return get_log_writer().get_stream();
+  }
+#endif
+}
+
+void log_flush()
+{
+#ifndef __ANDROID__
+  if (!s_log_writer_closed)
+    get_log_writer().flush();
+#endif
+}
+
+void log_flush_crash()
+{
+#ifndef __ANDROID__
+  if (!s_log_writer_closed)
+    get_log_writer().drain();
 #endif
 }
 
@@ -41,6 +41,15 @@ void log_warning_callback(const std::string& str);
 
 std::ostream& get_logging_instance(bool use_console_buffer = true);
 
+/** Block until all log lines handed to the background writer have
+    been written to stderr. */
+void log_flush();
+
+/** Write the log lines still queued for the background writer from
+    the calling thread, without waiting for it. Only meant for the
+    crash handler. */
+void log_flush_crash();
+
 #endif
 
 /* EOF */
@@ -0,0 +1,57 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_OBJECT_POOL_HPP
+#define HEADER_SUPERTUX_UTIL_OBJECT_POOL_HPP
+
+#include <cstddef>
+
+#include "util/block_pool.hpp"
+
+/** A BlockPool sized for objects of type T, meant to back a class
+    specific operator new/delete. */
+template<typename T, size_t CHUNK_SIZE = 64>
+class ObjectPool final
+{
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "ObjectPool doesn't support over-aligned types");
+
+public:
+  ObjectPool() :
+    m_pool(sizeof(T), CHUNK_SIZE)
+  {}
+
+  inline void* allocate() { return m_pool.allocate(); }
+  inline void deallocate(void* ptr) { m_pool.deallocate(ptr); }
+
+  /** Number of objects currently handed out */
+  inline size_t get_used() const { return m_pool.get_used(); }
+
+  /** Number of objects the pool has room for */
+  inline size_t get_capacity() const { return m_pool.get_capacity(); }
+
+private:
+  BlockPool m_pool;
+
+private:
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+};
+
+#endif
+
+/* EOF */
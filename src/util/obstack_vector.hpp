@@ -0,0 +1,125 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_OBSTACK_VECTOR_HPP
+#define HEADER_SUPERTUX_UTIL_OBSTACK_VECTOR_HPP
+
+#include <assert.h>
+#include <algorithm>
+#include <new>
+#include <obstack.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/** A growable array whose storage is taken from an obstack. The
+    memory is never given back individually, it is reclaimed all at
+    once when the obstack is freed, so this is only suitable for
+    short-lived data such as the payload of drawing requests, which
+    live for a single frame.
+
+    Only trivially copyable types are supported, elements are moved
+    around with memcpy() and never destructed. */
+template<typename T>
+class ObstackVector final
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ObstackVector only supports trivially copyable types");
+
+public:
+  ObstackVector(obstack& obst) :
+    m_obst(obst),
+    m_data(nullptr),
+    m_size(0),
+    m_capacity(0)
+  {}
+
+  inline size_t size() const { return m_size; }
+  inline bool empty() const { return m_size == 0; }
+
+  inline T* data() { return m_data; }
+  inline const T* data() const { return m_data; }
+
+  inline T* begin() { return m_data; }
+  inline T* end() { return m_data + m_size; }
+  inline const T* begin() const { return m_data; }
+  inline const T* end() const { return m_data + m_size; }
+
+  inline T& operator[](size_t idx) { assert(idx < m_size); return m_data[idx]; }
+  inline const T& operator[](size_t idx) const { assert(idx < m_size); return m_data[idx]; }
+
+  void reserve(size_t capacity)
+  {
+    if (capacity <= m_capacity)
+      return;
+
+    T* data = static_cast<T*>(obstack_alloc(&m_obst, static_cast<int>(sizeof(T) * capacity)));
+    if (m_size > 0)
+      memcpy(static_cast<void*>(data), m_data, sizeof(T) * m_size);
+
+    // The old block stays in the obstack until the end of the frame.
+    m_data = data;
+    m_capacity = capacity;
+  }
+
+  template<typename... Args>
+  T& emplace_back(Args&&... args)
+  {
+    if (m_size == m_capacity)
+      reserve(std::max<size_t>(4, m_capacity * 2));
+
+    T* item = new(m_data + m_size) T(std::forward<Args>(args)...);
+    m_size += 1;
+    return *item;
+  }
+
+  inline void push_back(const T& value) { emplace_back(value); }
+
+  /** Replace the contents with 'count' copies of 'value'. */
+  void assign(size_t count, const T& value)
+  {
+    m_size = 0;
+    reserve(count);
+    std::fill_n(m_data, count, value);
+    m_size = count;
+  }
+
+  /** Replace the contents with a copy of 'values'. */
+  void assign(const std::vector<T>& values)
+  {
+    m_size = 0;
+    reserve(values.size());
+    if (!values.empty())
+      memcpy(static_cast<void*>(m_data), values.data(), sizeof(T) * values.size());
+    m_size = values.size();
+  }
+
+private:
+  obstack& m_obst;
+  T* m_data;
+  size_t m_size;
+  size_t m_capacity;
+
+private:
+  ObstackVector(const ObstackVector&) = delete;
+  ObstackVector& operator=(const ObstackVector&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -0,0 +1,242 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/profiler.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+#include "util/allocation_counter.hpp"
+
+Profiler g_profiler;
+
+namespace {
+
+void write_json_string(std::ostream& out, const char* text)
+{
+  out << '"';
+  for (const char* c = text; *c != '\0'; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      out << '\\';
+    out << *c;
+  }
+  out << '"';
+}
+
+} // namespace
+
+Profiler::Profiler() :
+  m_enabled(false),
+  m_in_frame(false),
+  m_epoch(std::chrono::steady_clock::now()),
+  m_current(),
+  m_stack(),
+  m_history(HISTORY_SIZE),
+  m_history_next(0),
+  m_history_count(0)
+{
+}
+
+void
+Profiler::set_enabled(bool enabled)
+{
+  if (m_enabled == enabled)
+    return;
+
+  m_enabled = enabled;
+  m_in_frame = false;
+  m_stack.clear();
+  m_current.zones.clear();
+
+  if (m_enabled)
+  {
+    m_epoch = std::chrono::steady_clock::now();
+    m_history_next = 0;
+    m_history_count = 0;
+  }
+}
+
+void
+Profiler::begin_frame()
+{
+  if (!m_enabled)
+    return;
+
+  if (m_in_frame)
+    end_frame();
+
+  m_in_frame = true;
+  m_current.start_us = now_us();
+  m_current.duration_us = 0;
+  m_current.allocations = static_cast<int64_t>(AllocationCounter::get_count());
+  m_current.zones.clear();
+  m_stack.clear();
+}
+
+void
+Profiler::end_frame()
+{
+  const int64_t now = now_us();
+  const int64_t allocations = static_cast<int64_t>(AllocationCounter::get_count());
+
+  // Zones still open at the end of the frame are cut off there.
+  for (const size_t idx : m_stack)
+  {
+    Zone& zone = m_current.zones[idx];
+    zone.duration_us = now - m_current.start_us - zone.start_us;
+    zone.allocations = allocations - zone.allocations;
+  }
+  m_stack.clear();
+
+  m_current.duration_us = now - m_current.start_us;
+  m_current.allocations = allocations - m_current.allocations;
+
+  // Swap instead of copy, so that the zone vectors keep their
+  // capacity and recording doesn't allocate once warmed up.
+  Frame& slot = m_history[m_history_next];
+  std::swap(slot, m_current);
+  m_history_next = (m_history_next + 1) % HISTORY_SIZE;
+  m_history_count = std::min(m_history_count + 1, HISTORY_SIZE);
+
+  m_in_frame = false;
+}
+
+bool
+Profiler::push_zone(const char* name)
+{
+  if (!m_in_frame)
+    return false;
+
+  m_stack.push_back(m_current.zones.size());
+
+  // 'allocations' holds the count at the start until the zone is closed.
+  m_current.zones.push_back({ name, static_cast<int>(m_stack.size()) - 1,
+                              now_us() - m_current.start_us, 0,
+                              static_cast<int64_t>(AllocationCounter::get_count()) });
+  return true;
+}
+
+void
+Profiler::pop_zone()
+{
+  // The frame may have ended or the profiler been toggled while the
+  // zone was open.
+  if (m_stack.empty())
+    return;
+
+  Zone& zone = m_current.zones[m_stack.back()];
+  zone.duration_us = now_us() - m_current.start_us - zone.start_us;
+  zone.allocations = static_cast<int64_t>(AllocationCounter::get_count()) - zone.allocations;
+  m_stack.pop_back();
+}
+
+const Profiler::Frame*
+Profiler::get_last_frame() const
+{
+  if (m_history_count == 0)
+    return nullptr;
+
+  return &get_history_frame(0);
+}
+
+std::vector<Profiler::Statistic>
+Profiler::get_statistics(size_t frames) const
+{
+  frames = std::min(frames, m_history_count);
+
+  std::vector<Statistic> result;
+  std::vector<int> counts;
+  for (size_t age = frames; age-- > 0;)
+  {
+    for (const auto& zone : get_history_frame(age).zones)
+    {
+      const float ms = static_cast<float>(zone.duration_us) / 1000.0f;
+      const float allocations = static_cast<float>(zone.allocations);
+
+      auto it = std::find_if(result.begin(), result.end(),
+                             [&zone](const Statistic& stat) {
+                               return stat.depth == zone.depth && strcmp(stat.name, zone.name) == 0;
+                             });
+      if (it == result.end())
+      {
+        result.push_back({ zone.name, zone.depth, ms, ms, allocations });
+        counts.push_back(1);
+      }
+      else
+      {
+        // Zones entered several times in a frame count once per entry.
+        it->avg_ms += ms;
+        it->max_ms = std::max(it->max_ms, ms);
+        it->avg_allocations += allocations;
+        counts[it - result.begin()] += 1;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < result.size(); ++i)
+  {
+    result[i].avg_ms /= static_cast<float>(counts[i]);
+    result[i].avg_allocations /= static_cast<float>(counts[i]);
+  }
+
+  return result;
+}
+
+void
+Profiler::write_chrome_trace(std::ostream& out) const
+{
+  out << "{\"traceEvents\":[";
+
+  bool first = true;
+  for (size_t age = m_history_count; age-- > 0;)
+  {
+    const Frame& frame = get_history_frame(age);
+
+    out << (first ? "" : ",") << "\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+        << ",\"ts\":" << frame.start_us << ",\"dur\":" << frame.duration_us
+        << ",\"args\":{\"allocations\":" << frame.allocations << "}}";
+    first = false;
+
+    for (const auto& zone : frame.zones)
+    {
+      out << ",\n{\"name\":";
+      write_json_string(out, zone.name);
+      out << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+          << ",\"ts\":" << frame.start_us + zone.start_us
+          << ",\"dur\":" << zone.duration_us
+          << ",\"args\":{\"allocations\":" << zone.allocations << "}}";
+    }
+  }
+
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+int64_t
+Profiler::now_us() const
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+const Profiler::Frame&
+Profiler::get_history_frame(size_t age) const
+{
+  return m_history[(m_history_next + HISTORY_SIZE - 1 - age) % HISTORY_SIZE];
+}
+
+/* EOF */
@@ -0,0 +1,146 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_PROFILER_HPP
+#define HEADER_SUPERTUX_UTIL_PROFILER_HPP
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/** Records nested, named timing zones per frame with microsecond
+    resolution. Nothing is recorded while the profiler is disabled,
+    so zones can stay in hot code paths. */
+class Profiler final
+{
+public:
+  struct Zone
+  {
+    const char* name;
+    int depth;
+
+    /** Start time in microseconds, relative to the frame start */
+    int64_t start_us;
+    int64_t duration_us;
+
+    /** Heap allocations made while the zone was open, always zero
+        without allocation tracking */
+    int64_t allocations;
+  };
+
+  struct Frame
+  {
+    /** Start time in microseconds, relative to when the profiler was
+        enabled */
+    int64_t start_us;
+    int64_t duration_us;
+    int64_t allocations;
+    std::vector<Zone> zones;
+  };
+
+  struct Statistic
+  {
+    const char* name;
+    int depth;
+    float avg_ms;
+    float max_ms;
+    float avg_allocations;
+  };
+
+public:
+  /** Number of frames kept for statistics and trace export */
+  static constexpr size_t HISTORY_SIZE = 300;
+
+public:
+  Profiler();
+
+  void set_enabled(bool enabled);
+  inline bool is_enabled() const { return m_enabled; }
+
+  /** Finish the current frame, if any, and start a new one. */
+  void begin_frame();
+
+  /** Returns false if the zone wasn't recorded, in which case
+      pop_zone() must not be called for it. */
+  bool push_zone(const char* name);
+  void pop_zone();
+
+  /** The most recently completed frame, nullptr if there is none */
+  const Frame* get_last_frame() const;
+
+  /** Average and maximum time of each zone over the last 'frames'
+      completed frames, in order of first appearance. */
+  std::vector<Statistic> get_statistics(size_t frames) const;
+
+  /** Write the recorded history in the Chrome trace event format,
+      to be loaded in chrome://tracing or Perfetto. */
+  void write_chrome_trace(std::ostream& out) const;
+
+private:
+  int64_t now_us() const;
+  void end_frame();
+  const Frame& get_history_frame(size_t age) const;
+
+private:
+  bool m_enabled;
+  bool m_in_frame;
+  std::chrono::steady_clock::time_point m_epoch;
+
+  Frame m_current;
+
+  /** Indices into m_current.zones of the zones that are still open */
+  std::vector<size_t> m_stack;
+
+  /** Ring buffer of completed frames */
+  std::vector<Frame> m_history;
+  size_t m_history_next;
+  size_t m_history_count;
+
+private:
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+};
+
+extern Profiler g_profiler;
+
+/** Records the lifetime of the object as a zone of g_profiler. */
+class ProfileZone final
+{
+public:
+  explicit ProfileZone(const char* name) :
+    m_recording(g_profiler.is_enabled() && g_profiler.push_zone(name))
+  {}
+
+  ~ProfileZone()
+  {
+    if (m_recording)
+      g_profiler.pop_zone();
+  }
+
+private:
+  bool m_recording;
+
+private:
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -0,0 +1,459 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/reader_bundle.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <physfs.h>
+#include <sexp/parser.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string.h>
+
+#include "physfs/ifile_stream.hpp"
+#include "physfs/util.hpp"
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+
+/* Layout, all numbers little endian:
+
+   "STBUNDLE" u32:version
+   u32:string_count { u32:length bytes }*
+   u32:entry_count { u32:path u64:size u64:modtime u32:offset }*
+   values
+
+   A value is a u8 type followed by: nothing (nil), u8 (boolean),
+   u32 (integer, real), u32 string index (string, symbol) or u32
+   count and that many values (array). */
+
+namespace {
+
+const char MAGIC[8] = { 'S', 'T', 'B', 'U', 'N', 'D', 'L', 'E' };
+const uint32_t VERSION = 1;
+
+/** Nesting deeper than this is treated as a corrupt bundle */
+const int MAX_DEPTH = 256;
+
+enum ValueTag : uint8_t
+{
+  TAG_NIL,
+  TAG_BOOLEAN,
+  TAG_INTEGER,
+  TAG_REAL,
+  TAG_STRING,
+  TAG_SYMBOL,
+  TAG_ARRAY
+};
+
+const char* const BUNDLED_EXTENSIONS[] = {
+  ".sprite", ".strf", ".satc", ".stf", ".surface", ".stl", ".stwm"
+};
+
+std::string bundle_key(const std::string& filename)
+{
+  std::string key = FileSystem::normalize(filename);
+  key.erase(0, key.find_first_not_of('/'));
+  return key;
+}
+
+bool is_bundled(const std::string& filename)
+{
+  const std::string ext = FileSystem::extension(filename);
+  for (const char* bundled : BUNDLED_EXTENSIONS)
+  {
+    if (ext == bundled)
+      return true;
+  }
+  return false;
+}
+
+void put_u32(std::string& out, uint32_t value)
+{
+  for (int i = 0; i < 4; ++i)
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+}
+
+void put_u64(std::string& out, uint64_t value)
+{
+  for (int i = 0; i < 8; ++i)
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+}
+
+class BundleWriter final
+{
+public:
+  BundleWriter() :
+    m_strings(),
+    m_string_index(),
+    m_entries(),
+    m_entry_count(0),
+    m_values()
+  {}
+
+  void add(const std::string& filename, const PHYSFS_Stat& stat, const sexp::Value& value)
+  {
+    // Serialize first, so that an unsupported value leaves no entry behind.
+    std::string data;
+    write_value(data, value);
+
+    put_u32(m_entries, get_string(bundle_key(filename)));
+    put_u64(m_entries, static_cast<uint64_t>(stat.filesize));
+    put_u64(m_entries, static_cast<uint64_t>(stat.modtime));
+    put_u32(m_entries, static_cast<uint32_t>(m_values.size()));
+    m_values += data;
+    m_entry_count += 1;
+  }
+
+  void write(std::ostream& out) const
+  {
+    std::string header(MAGIC, sizeof(MAGIC));
+    put_u32(header, VERSION);
+
+    put_u32(header, static_cast<uint32_t>(m_strings.size()));
+    for (const auto& str : m_strings)
+    {
+      put_u32(header, static_cast<uint32_t>(str.size()));
+      header += str;
+    }
+
+    put_u32(header, m_entry_count);
+
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(m_entries.data(), static_cast<std::streamsize>(m_entries.size()));
+    out.write(m_values.data(), static_cast<std::streamsize>(m_values.size()));
+  }
+
+  inline uint32_t get_entry_count() const { return m_entry_count; }
+
+private:
+  uint32_t get_string(const std::string& str)
+  {
+    auto it = m_string_index.find(str);
+    if (it != m_string_index.end())
+      return it->second;
+
+    const uint32_t index = static_cast<uint32_t>(m_strings.size());
+    m_strings.push_back(str);
+    m_string_index[str] = index;
+    return index;
+  }
+
+  void write_value(std::string& out, const sexp::Value& value)
+  {
+    switch (value.get_type())
+    {
+      case sexp::Value::Type::NIL:
+        out.push_back(static_cast<char>(TAG_NIL));
+        break;
+
+      case sexp::Value::Type::BOOLEAN:
+        out.push_back(static_cast<char>(TAG_BOOLEAN));
+        out.push_back(static_cast<char>(value.as_bool() ? 1 : 0));
+        break;
+
+      case sexp::Value::Type::INTEGER:
+        out.push_back(static_cast<char>(TAG_INTEGER));
+        put_u32(out, static_cast<uint32_t>(value.as_int()));
+        break;
+
+      case sexp::Value::Type::REAL:
+      {
+        const float real = value.as_float();
+        uint32_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        out.push_back(static_cast<char>(TAG_REAL));
+        put_u32(out, bits);
+        break;
+      }
+
+      case sexp::Value::Type::STRING:
+        out.push_back(static_cast<char>(TAG_STRING));
+        put_u32(out, get_string(value.as_string()));
+        break;
+
+      case sexp::Value::Type::SYMBOL:
+        out.push_back(static_cast<char>(TAG_SYMBOL));
+        put_u32(out, get_string(value.as_string()));
+        break;
+
+      case sexp::Value::Type::ARRAY:
+        out.push_back(static_cast<char>(TAG_ARRAY));
+        put_u32(out, static_cast<uint32_t>(value.as_array().size()));
+        for (const auto& item : value.as_array())
+          write_value(out, item);
+        break;
+
+      default:
+        // Cons cells don't show up when parsing with USE_ARRAYS.
+        throw std::runtime_error("unsupported value type");
+    }
+  }
+
+private:
+  std::vector<std::string> m_strings;
+  std::unordered_map<std::string, uint32_t> m_string_index;
+  std::string m_entries;
+  uint32_t m_entry_count;
+  std::string m_values;
+
+private:
+  BundleWriter(const BundleWriter&) = delete;
+  BundleWriter& operator=(const BundleWriter&) = delete;
+};
+
+class BundleReader final
+{
+public:
+  BundleReader(const std::vector<char>& data, size_t pos) :
+    m_data(data),
+    m_pos(pos)
+  {}
+
+  uint8_t u8()
+  {
+    check(1);
+    return static_cast<uint8_t>(m_data[m_pos++]);
+  }
+
+  uint32_t u32()
+  {
+    check(4);
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+      value |= static_cast<uint32_t>(static_cast<uint8_t>(m_data[m_pos++])) << (8 * i);
+    return value;
+  }
+
+  uint64_t u64()
+  {
+    const uint64_t low = u32();
+    const uint64_t high = u32();
+    return low | (high << 32);
+  }
+
+  std::string bytes(size_t length)
+  {
+    check(length);
+    std::string result(m_data.data() + m_pos, length);
+    m_pos += length;
+    return result;
+  }
+
+  inline size_t get_pos() const { return m_pos; }
+
+private:
+  void check(size_t length) const
+  {
+    if (m_pos > m_data.size() || m_data.size() - m_pos < length)
+      throw std::runtime_error("unexpected end of bundle");
+  }
+
+private:
+  const std::vector<char>& m_data;
+  size_t m_pos;
+
+private:
+  BundleReader(const BundleReader&) = delete;
+  BundleReader& operator=(const BundleReader&) = delete;
+};
+
+} // namespace
+
+const char* const ReaderBundle::FILENAME = "data.bundle";
+
+int
+ReaderBundle::build(const std::string& filename)
+{
+  BundleWriter writer;
+  const char* write_dir = PHYSFS_getWriteDir();
+
+  physfsutil::enumerate_files_recurse("/", [&writer, write_dir](const std::string& path) {
+    if (!is_bundled(path))
+      return false;
+
+    // Files of the user directory, e.g. levels made in the editor,
+    // don't belong into the bundle.
+    const char* real_dir = PHYSFS_getRealDir(path.c_str());
+    if (!real_dir || (write_dir && strcmp(real_dir, write_dir) == 0))
+      return false;
+
+    PHYSFS_Stat stat;
+    if (!PHYSFS_stat(path.c_str(), &stat))
+      return false;
+
+    try
+    {
+      IFileStream in(path);
+      writer.add(path, stat, sexp::Parser::from_stream(in, sexp::Parser::USE_ARRAYS));
+    }
+    catch (const std::exception& err)
+    {
+      log_warning << "Not bundling '" << path << "': " << err.what() << std::endl;
+    }
+    return false;
+  });
+
+  std::ofstream out(filename, std::ios::binary);
+  writer.write(out);
+  out.close();
+  if (!out)
+    throw std::runtime_error("Couldn't write bundle '" + filename + "'");
+
+  log_info << "Wrote " << writer.get_entry_count() << " files to '" << filename << "'" << std::endl;
+  return static_cast<int>(writer.get_entry_count());
+}
+
+ReaderBundle::ReaderBundle(const std::string& filename) :
+  m_data(),
+  m_strings(),
+  m_entries(),
+  m_values_offset()
+{
+  IFileStream in(filename);
+  m_data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+  BundleReader reader(m_data, 0);
+  if (reader.bytes(sizeof(MAGIC)) != std::string(MAGIC, sizeof(MAGIC)))
+    throw std::runtime_error("'" + filename + "' is not a data bundle");
+  if (reader.u32() != VERSION)
+    throw std::runtime_error("'" + filename + "' has an unsupported version");
+
+  // Every string takes at least its length, so a corrupt count can't
+  // reserve more than the file could hold.
+  const uint32_t string_count = reader.u32();
+  m_strings.reserve(std::min<size_t>(string_count, (m_data.size() - reader.get_pos()) / 4));
+  for (uint32_t i = 0; i < string_count; ++i)
+    m_strings.push_back(reader.bytes(reader.u32()));
+
+  const uint32_t entry_count = reader.u32();
+  for (uint32_t i = 0; i < entry_count; ++i)
+  {
+    const uint32_t path = reader.u32();
+    Entry entry;
+    entry.size = static_cast<int64_t>(reader.u64());
+    entry.modtime = static_cast<int64_t>(reader.u64());
+    entry.offset = reader.u32();
+
+    if (path >= m_strings.size())
+      throw std::runtime_error("'" + filename + "' is corrupt");
+    m_entries[m_strings[path]] = entry;
+  }
+
+  m_values_offset = reader.get_pos();
+
+  // Every value has to start inside of the value section.
+  for (const auto& it : m_entries)
+  {
+    if (it.second.offset >= m_data.size() - m_values_offset)
+      throw std::runtime_error("'" + filename + "' is corrupt");
+  }
+  log_info << "Loaded " << m_entries.size() << " pre-parsed files from '" << filename << "'" << std::endl;
+}
+
+std::optional<sexp::Value>
+ReaderBundle::find(const std::string& filename) const
+{
+  auto it = m_entries.find(bundle_key(filename));
+  if (it == m_entries.end())
+    return std::nullopt;
+
+  PHYSFS_Stat stat;
+  if (!PHYSFS_stat(filename.c_str(), &stat) ||
+      stat.filesize != it->second.size ||
+      stat.modtime != it->second.modtime)
+    return std::nullopt;
+
+  try
+  {
+    size_t pos = m_values_offset + it->second.offset;
+    return read_value(pos, 0);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't read '" << filename << "' from bundle: " << err.what() << std::endl;
+    return std::nullopt;
+  }
+}
+
+sexp::Value
+ReaderBundle::read_value(size_t& pos, int depth) const
+{
+  if (depth > MAX_DEPTH)
+    throw std::runtime_error("nesting too deep");
+
+  BundleReader reader(m_data, pos);
+  const uint8_t tag = reader.u8();
+
+  switch (tag)
+  {
+    case TAG_NIL:
+      pos = reader.get_pos();
+      return sexp::Value::nil();
+
+    case TAG_BOOLEAN:
+    {
+      const bool value = (reader.u8() != 0);
+      pos = reader.get_pos();
+      return sexp::Value::boolean(value);
+    }
+
+    case TAG_INTEGER:
+    {
+      const int value = static_cast<int>(reader.u32());
+      pos = reader.get_pos();
+      return sexp::Value::integer(value);
+    }
+
+    case TAG_REAL:
+    {
+      const uint32_t bits = reader.u32();
+      float value;
+      memcpy(&value, &bits, sizeof(value));
+      pos = reader.get_pos();
+      return sexp::Value::real(value);
+    }
+
+    case TAG_STRING:
+    case TAG_SYMBOL:
+    {
+      const uint32_t index = reader.u32();
+      if (index >= m_strings.size())
+        throw std::runtime_error("invalid string index");
+      pos = reader.get_pos();
+      return (tag == TAG_SYMBOL) ? sexp::Value::symbol(m_strings[index]) : sexp::Value::string(m_strings[index]);
+    }
+
+    case TAG_ARRAY:
+    {
+      const uint32_t count = reader.u32();
+      pos = reader.get_pos();
+
+      std::vector<sexp::Value> items;
+      items.reserve(std::min<size_t>(count, m_data.size() - pos));
+      for (uint32_t i = 0; i < count; ++i)
+        items.push_back(read_value(pos, depth + 1));
+      return sexp::Value::array(std::move(items));
+    }
+
+    default:
+      throw std::runtime_error("invalid value type");
+  }
+}
+
+/* EOF */
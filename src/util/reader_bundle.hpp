@@ -0,0 +1,85 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_READER_BUNDLE_HPP
+#define HEADER_SUPERTUX_UTIL_READER_BUNDLE_HPP
+
+#include <optional>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sexp/value.hpp>
+
+#include "util/currenton.hpp"
+
+/** A pre-parsed copy of the data files that are read through
+    ReaderDocument (sprites, tilesets, autotiles, fonts, surfaces and
+    levels), stored in a single binary file with a shared string
+    table, so that loading them doesn't require parsing text.
+
+    Every entry remembers size and modification time of the file it
+    was built from, as soon as the file visible through PhysFS no
+    longer matches, e.g. because it was edited or an add-on overrides
+    it, the entry is ignored and the text gets parsed as usual. */
+class ReaderBundle final : public Currenton<ReaderBundle>
+{
+public:
+  static const char* const FILENAME;
+
+  /** Parse all bundled file types of the data directory and write
+      the result to the given OS path, returns the number of files. */
+  static int build(const std::string& filename);
+
+private:
+  struct Entry
+  {
+    int64_t size;
+    int64_t modtime;
+    uint32_t offset;
+  };
+
+public:
+  /** Load the bundle from the given PhysFS path */
+  ReaderBundle(const std::string& filename);
+
+  /** Returns the contents of the given file, if the bundle holds an
+      up-to-date copy of it */
+  std::optional<sexp::Value> find(const std::string& filename) const;
+
+  inline size_t size() const { return m_entries.size(); }
+
+private:
+  sexp::Value read_value(size_t& pos, int depth) const;
+
+private:
+  std::vector<char> m_data;
+  std::vector<std::string> m_strings;
+  std::unordered_map<std::string, Entry> m_entries;
+
+  /** Offset of the serialized values in m_data */
+  size_t m_values_offset;
+
+private:
+  ReaderBundle(const ReaderBundle&) = delete;
+  ReaderBundle& operator=(const ReaderBundle&) = delete;
+};
+
+#endif
+
+/* EOF */
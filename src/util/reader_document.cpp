@@ -22,6 +22,7 @@
 #include "physfs/ifile_stream.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
+#include "util/reader_bundle.hpp"
 
 ReaderDocument
 ReaderDocument::from_stream(std::istream& stream, const std::string& filename)
@@ -35,6 +36,12 @@ ReaderDocument::from_file(const std::string& filename)
 {
   log_debug << "ReaderDocument::parse: " << filename << std::endl;
 
+  if (ReaderBundle::current())
+  {
+    if (auto sx = ReaderBundle::current()->find(filename))
+      return ReaderDocument(filename, std::move(*sx));
+  }
+
   IFileStream in(filename);
   if (!in.good()) {
     std::stringstream msg;
@@ -0,0 +1,77 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/size_class_allocator.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace {
+
+/** Keep a chunk at roughly 16 KiB, but never below 8 blocks */
+size_t get_chunk_size(size_t block_size)
+{
+  return std::max(static_cast<size_t>(16384) / block_size, static_cast<size_t>(8));
+}
+
+} // namespace
+
+SizeClassAllocator::SizeClassAllocator() :
+  m_pools(MAX_SIZE / GRANULARITY)
+{
+}
+
+void*
+SizeClassAllocator::allocate(size_t size)
+{
+  if (size == 0 || size > MAX_SIZE)
+    return ::operator new(size);
+
+  auto& pool = m_pools[(size - 1) / GRANULARITY];
+  if (!pool)
+  {
+    const size_t block_size = ((size - 1) / GRANULARITY + 1) * GRANULARITY;
+    pool = std::make_unique<BlockPool>(block_size, get_chunk_size(block_size));
+  }
+  return pool->allocate();
+}
+
+void
+SizeClassAllocator::deallocate(void* ptr, size_t size)
+{
+  if (!ptr)
+    return;
+
+  if (size == 0 || size > MAX_SIZE)
+  {
+    ::operator delete(ptr);
+    return;
+  }
+
+  m_pools[(size - 1) / GRANULARITY]->deallocate(ptr);
+}
+
+const BlockPool*
+SizeClassAllocator::get_pool(size_t size) const
+{
+  if (size == 0 || size > MAX_SIZE)
+    return nullptr;
+
+  return m_pools[(size - 1) / GRANULARITY].get();
+}
+
+/* EOF */
@@ -0,0 +1,61 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_UTIL_SIZE_CLASS_ALLOCATOR_HPP
+#define HEADER_SUPERTUX_UTIL_SIZE_CLASS_ALLOCATOR_HPP
+
+#include <memory>
+#include <stddef.h>
+#include <vector>
+
+#include "util/block_pool.hpp"
+
+/** Serves allocations of varying size from a set of BlockPools, one
+    for each multiple of GRANULARITY bytes, e.g. for a class hierarchy
+    whose objects are created and destroyed in bursts. Sizes above
+    MAX_SIZE are passed on to the global operator new.
+
+    deallocate() must be given the same size as allocate(), which is
+    what a sized class specific operator delete receives. */
+class SizeClassAllocator final
+{
+public:
+  static const size_t GRANULARITY = 64;
+  static const size_t MAX_SIZE = 2048;
+
+public:
+  SizeClassAllocator();
+
+  void* allocate(size_t size);
+  void deallocate(void* ptr, size_t size);
+
+  /** Returns the pool serving the given size, nullptr if the size is
+      passed on to operator new or no object of it was allocated yet */
+  const BlockPool* get_pool(size_t size) const;
+
+private:
+  /** Pools are only created once an object of their size shows up */
+  std::vector<std::unique_ptr<BlockPool> > m_pools;
+
+private:
+  SizeClassAllocator(const SizeClassAllocator&) = delete;
+  SizeClassAllocator& operator=(const SizeClassAllocator&) = delete;
+};
+
+#endif
+
+/* EOF */
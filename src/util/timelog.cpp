@@ -22,7 +22,7 @@
 #include "util/log.hpp"
 
 Timelog::Timelog() :
-  m_last_ticks(0),
+  m_last_time(),
   m_last_component(nullptr)
 {
 }
@@ -30,15 +30,16 @@ Timelog::Timelog() :
 void
 Timelog::log(const char* component)
 {
-  Uint32 current_ticks = SDL_GetTicks();
+  const auto current_time = std::chrono::steady_clock::now();
 
   if (m_last_component != nullptr) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(current_time - m_last_time);
     log_info << "Component '" << m_last_component <<  "' finished after "
-             << (current_ticks - m_last_ticks) / 1000.0 << " seconds"
+             << static_cast<double>(elapsed.count()) / 1000000.0 << " seconds"
              << std::endl;
   }
 
-  m_last_ticks = current_ticks;
+  m_last_time = current_time;
   m_last_component = component;
 }
 
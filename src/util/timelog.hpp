@@ -17,7 +17,7 @@
 #ifndef HEADER_SUPERTUX_UTIL_TIMELOG_HPP
 #define HEADER_SUPERTUX_UTIL_TIMELOG_HPP
 
-#include <SDL.h>
+#include <chrono>
 
 class Timelog
 {
@@ -27,7 +27,7 @@ public:
   void log(const char* component = nullptr);
 
 private:
-  Uint32 m_last_ticks;
+  std::chrono::steady_clock::time_point m_last_time;
   const char* m_last_component = nullptr;
 
 private:
@@ -63,7 +63,9 @@ BitmapFont::BitmapFont(GlyphWidth glyph_width_,
   shadowsize(shadowsize_),
   border(0),
   rtl(false),
-  glyphs(65536)
+  glyphs(65536),
+  batch_srcrects(),
+  batch_dstrects()
 {
   for (unsigned int i=0; i<65536;i++) glyphs[i].surface_idx = -1;
 
@@ -416,6 +418,20 @@ BitmapFont::draw_text(Canvas& canvas, const std::string& text, const Vector& pos
 void
 BitmapFont::draw_chars(Canvas& canvas, bool notshadow, const std::string& text, const Vector& pos, int layer, Color color) const
 {
+  const std::vector<SurfacePtr>& surfaces = notshadow ? glyph_surfaces : shadow_surfaces;
+
+  // Glyphs are collected per surface, so that a whole string ends up
+  // in one request for each glyph image instead of one per character.
+  std::vector<std::vector<Rectf> >& srcrects = batch_srcrects;
+  std::vector<std::vector<Rectf> >& dstrects = batch_dstrects;
+  srcrects.resize(surfaces.size());
+  dstrects.resize(surfaces.size());
+  for (size_t i = 0; i < surfaces.size(); ++i)
+  {
+    srcrects[i].clear();
+    dstrects[i].clear();
+  }
+
   Vector p = pos;
 
   for (UTF8Iterator it(text); !it.done(); ++it)
@@ -437,18 +453,21 @@ BitmapFont::draw_chars(Canvas& canvas, bool notshadow, const std::string& text,
       else
         glyph = glyphs[0x20];
 
-      // FIXME: not supported! request.color = color;
-      canvas.draw_surface_part(notshadow ?
-                               glyph_surfaces[glyph.surface_idx] :
-                               shadow_surfaces[glyph.surface_idx],
-                               glyph.rect,
-                               Rectf(p + glyph.offset, glyph.rect.get_size()),
-                               layer,
-                               PaintStyle().set_color(color));
+      srcrects[glyph.surface_idx].push_back(glyph.rect);
+      dstrects[glyph.surface_idx].push_back(Rectf(p + glyph.offset, glyph.rect.get_size()));
 
       p.x += glyph.advance;
     }
   }
+
+  for (size_t i = 0; i < surfaces.size(); ++i)
+  {
+    if (srcrects[i].empty())
+      continue;
+
+    canvas.draw_surface_batch(surfaces[i], srcrects[i], dstrects[i],
+                              color, layer);
+  }
 }
 
 /* EOF */
@@ -125,6 +125,11 @@ private:
 
   /** 65536 of glyphs */
   std::vector<Glyph> glyphs;
+
+  /** Scratch space of draw_chars(), one list per surface, kept so
+      that drawing text doesn't allocate */
+  mutable std::vector<std::vector<Rectf> > batch_srcrects;
+  mutable std::vector<std::vector<Rectf> > batch_dstrects;
 };
 
 #endif
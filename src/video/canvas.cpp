@@ -18,10 +18,13 @@
 
 #include <algorithm>
 #include <array>
+#include <assert.h>
+#include <math.h>
 
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
 #include "util/obstackpp.hpp"
+#include "util/profiler.hpp"
 #include "video/drawing_context.hpp"
 #include "video/drawing_request.hpp"
 #include "video/painter.hpp"
@@ -55,6 +58,8 @@ Canvas::clear()
 void
 Canvas::render(Renderer& renderer, Filter filter)
 {
+  ProfileZone profile_zone("Canvas::render");
+
   // On a regular level, each frame has around 50-250 requests (before
   // batching it was 1000-3000), the sort comparator function is
   // called approximatly 3-7 times for each request.
@@ -90,6 +95,10 @@ Canvas::render(Renderer& renderer, Filter filter)
         painter.draw_filled_rect(static_cast<const FillRectRequest&>(request));
         break;
 
+      case RequestType::FILLRECTS:
+        painter.draw_filled_rects(static_cast<const FillRectsRequest&>(request));
+        break;
+
       case RequestType::INVERSEELLIPSE:
         painter.draw_inverse_ellipse(static_cast<const InverseEllipseRequest&>(request));
         break;
@@ -98,6 +107,10 @@ Canvas::render(Renderer& renderer, Filter filter)
         painter.draw_line(static_cast<const LineRequest&>(request));
         break;
 
+      case RequestType::LINES:
+        painter.draw_lines(static_cast<const LinesRequest&>(request));
+        break;
+
       case RequestType::TRIANGLE:
         painter.draw_triangle(static_cast<const TriangleRequest&>(request));
         break;
@@ -127,16 +140,32 @@ Canvas::draw_surface(const SurfacePtr& surface,
      position.y + static_cast<float>(surface->get_height()) < cliprect.get_top())
     return;
 
-  auto request = new(m_obst) TextureRequest(m_context.transform());
+  const Flip flip = m_context.transform().flip ^ surface->get_flip();
+  const Rectf dstrect(apply_translate(position) * scale(),
+                      Sizef(static_cast<float>(surface->get_width()) * scale(),
+                            static_cast<float>(surface->get_height()) * scale()));
+
+  if (auto batch = get_batchable_request(*surface, flip, blend, layer))
+  {
+    if (batch->colors.empty() && batch->color != color)
+      batch->colors.assign(batch->srcrects.size(), batch->color);
+
+    batch->srcrects.emplace_back(Rectf(surface->get_region()));
+    batch->dstrects.emplace_back(dstrect);
+    batch->angles.emplace_back(angle);
+    if (!batch->colors.empty())
+      batch->colors.emplace_back(color);
+    return;
+  }
+
+  auto request = new(m_obst) TextureRequest(m_context.transform(), m_obst);
 
   request->layer = layer;
-  request->flip = m_context.transform().flip ^ surface->get_flip();
+  request->flip = flip;
   request->blend = blend;
 
   request->srcrects.emplace_back(Rectf(surface->get_region()));
-  request->dstrects.emplace_back(Rectf(apply_translate(position) * scale(),
-                                 Sizef(static_cast<float>(surface->get_width()) * scale(),
-                                       static_cast<float>(surface->get_height()) * scale())));
+  request->dstrects.emplace_back(dstrect);
   request->angles.emplace_back(angle);
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
@@ -165,7 +194,7 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 {
   if (!surface) return;
 
-  auto request = new(m_obst) TextureRequest(m_context.transform());
+  auto request = new(m_obst) TextureRequest(m_context.transform(), m_obst);
 
   request->layer = layer;
   request->flip = m_context.transform().flip ^ surface->get_flip();
@@ -184,46 +213,33 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
                            const Color& color,
                            int layer)
 {
-  const size_t len = srcrects.size();
-  draw_surface_batch(surface,
-                     std::move(srcrects),
-                     std::move(dstrects),
-                     std::vector<float>(len, 0.0f),
-                     color, layer);
+  if (!surface) return;
+
+  auto request = make_batch_request(*surface, srcrects, dstrects, color, layer);
+  request->angles.assign(srcrects.size(), 0.0f);
+
+  m_requests.push_back(request);
 }
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
-                           std::vector<float> angles,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
+                           const std::vector<float>& angles,
                            const Color& color,
                            int layer)
 {
   if (!surface) return;
 
-  auto request = new(m_obst) TextureRequest(m_context.transform());
-
-  request->layer = layer;
-  request->flip = m_context.transform().flip ^ surface->get_flip();
-  request->color = color;
-
-  request->srcrects = std::move(srcrects);
-  request->dstrects = std::move(dstrects);
-  request->angles = std::move(angles);
-
-  for (auto& dstrect : request->dstrects)
-  {
-    dstrect = Rectf(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale());
-  }
+  assert(angles.size() == srcrects.size());
 
-  request->texture = surface->get_texture().get();
-  request->displacement_texture = surface->get_displacement_texture().get();
+  auto request = make_batch_request(*surface, srcrects, dstrects, color, layer);
+  request->angles.assign(angles);
 
   m_requests.push_back(request);
 }
@@ -286,6 +302,27 @@ Canvas::draw_filled_rect(const Rectf& rect, const Color& color, float radius, in
   m_requests.push_back(request);
 }
 
+void
+Canvas::draw_filled_rects(const std::vector<Rectf>& rects, const Color& color, int layer)
+{
+  if (rects.empty()) return;
+
+  auto request = new(m_obst) FillRectsRequest(m_context.transform(), m_obst);
+
+  request->layer = layer;
+
+  request->rects.reserve(rects.size());
+  for (const auto& rect : rects)
+  {
+    request->rects.emplace_back(apply_translate(rect.p1())*scale(),
+                                rect.get_size()*scale());
+  }
+  request->color = color;
+  request->color.alpha = color.alpha * m_context.transform().alpha;
+
+  m_requests.push_back(request);
+}
+
 void
 Canvas::draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color& color, int layer)
 {
@@ -316,6 +353,67 @@ Canvas::draw_line(const Vector& pos1, const Vector& pos2, const Color& color, in
   m_requests.push_back(request);
 }
 
+void
+Canvas::draw_lines(const std::vector<Vector>& points, const Color& color, int layer)
+{
+  assert(points.size() % 2 == 0);
+
+  if (points.empty()) return;
+
+  auto request = new(m_obst) LinesRequest(m_context.transform(), m_obst);
+
+  request->layer = layer;
+
+  request->points.reserve(points.size());
+  for (const auto& point : points)
+  {
+    request->points.emplace_back(apply_translate(point)*scale());
+  }
+  request->color = color;
+  request->color.alpha = color.alpha * m_context.transform().alpha;
+
+  m_requests.push_back(request);
+}
+
+void
+Canvas::draw_grid(const Rectf& region, const Sizef& cell_size, const Color& color, int layer)
+{
+  if (cell_size.width <= 0.0f || cell_size.height <= 0.0f) return;
+
+  // The epsilon keeps the closing line of a region that is an exact
+  // multiple of the cell size from being lost to rounding.
+  const int columns = static_cast<int>(floorf(region.get_width() / cell_size.width + 0.001f)) + 1;
+  const int rows = static_cast<int>(floorf(region.get_height() / cell_size.height + 0.001f)) + 1;
+
+  auto request = new(m_obst) LinesRequest(m_context.transform(), m_obst);
+
+  request->layer = layer;
+
+  const Vector p1 = apply_translate(region.p1())*scale();
+  const Vector p2 = apply_translate(region.p2())*scale();
+  const float cell_width = cell_size.width * scale();
+  const float cell_height = cell_size.height * scale();
+
+  request->points.reserve(2 * (columns + rows));
+  for (int i = 0; i < columns; ++i)
+  {
+    const float x = p1.x + static_cast<float>(i) * cell_width;
+    request->points.emplace_back(x, p1.y);
+    request->points.emplace_back(x, p2.y);
+  }
+  for (int i = 0; i < rows; ++i)
+  {
+    const float y = p1.y + static_cast<float>(i) * cell_height;
+    request->points.emplace_back(p1.x, y);
+    request->points.emplace_back(p2.x, y);
+  }
+
+  request->color = color;
+  request->color.alpha = color.alpha * m_context.transform().alpha;
+
+  m_requests.push_back(request);
+}
+
 void
 Canvas::draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3, const Color& color, int layer)
 {
@@ -392,4 +490,56 @@ Canvas::scale() const
   return m_context.transform().scale;
 }
 
+TextureRequest*
+Canvas::make_batch_request(const Surface& surface,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
+                           const Color& color,
+                           int layer)
+{
+  assert(srcrects.size() == dstrects.size());
+
+  auto request = new(m_obst) TextureRequest(m_context.transform(), m_obst);
+
+  request->layer = layer;
+  request->flip = m_context.transform().flip ^ surface.get_flip();
+  request->color = color;
+
+  request->srcrects.assign(srcrects);
+
+  request->dstrects.reserve(dstrects.size());
+  for (const auto& dstrect : dstrects)
+  {
+    request->dstrects.emplace_back(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale());
+  }
+
+  request->texture = surface.get_texture().get();
+  request->displacement_texture = surface.get_displacement_texture().get();
+
+  return request;
+}
+
+TextureRequest*
+Canvas::get_batchable_request(const Surface& surface, Flip flip,
+                              const Blend& blend, int layer) const
+{
+  if (m_requests.empty() ||
+      m_requests.back()->get_type() != RequestType::TEXTURE)
+    return nullptr;
+
+  auto request = static_cast<TextureRequest*>(m_requests.back());
+  const DrawingTransform& transform = m_context.transform();
+
+  if (request->texture != surface.get_texture().get() ||
+      request->displacement_texture != surface.get_displacement_texture().get() ||
+      request->layer != layer ||
+      request->flip != flip ||
+      request->blend != blend ||
+      request->alpha != transform.alpha ||
+      !(request->viewport == transform.viewport))
+    return nullptr;
+
+  return request;
+}
+
 /* EOF */
@@ -28,6 +28,7 @@
 #include "video/blend.hpp"
 #include "video/color.hpp"
 #include "video/drawing_target.hpp"
+#include "video/flip.hpp"
 #include "video/font.hpp"
 #include "video/font_ptr.hpp"
 #include "video/gl.hpp"
@@ -37,8 +38,10 @@
 
 class DrawingContext;
 class Renderer;
+class Surface;
 class VideoSystem;
 struct DrawingRequest;
+struct TextureRequest;
 
 class Canvas final
 {
@@ -57,14 +60,14 @@ public:
   void draw_surface_scaled(const SurfacePtr& surface, const Rectf& dstrect,
                            int layer, const PaintStyle& style = PaintStyle());
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
+                          const std::vector<Rectf>& srcrects,
+                          const std::vector<Rectf>& dstrects,
                           const Color& color,
                           int layer);
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
-                          std::vector<float> angles,
+                          const std::vector<Rectf>& srcrects,
+                          const std::vector<Rectf>& dstrects,
+                          const std::vector<float>& angles,
                           const Color& color,
                           int layer);
   Rectf draw_text(const FontPtr& font, const std::string& text,
@@ -76,10 +79,25 @@ public:
                      const Rectf& region, const Blend& blend = Blend());
   void draw_filled_rect(const Rectf& rect, const Color& color, int layer);
   void draw_filled_rect(const Rectf& rect, const Color& color, float radius, int layer);
+  /** Draw multiple rectangles of the same color in a single request */
+  void draw_filled_rects(const std::vector<Rectf>& rects, const Color& color, int layer);
 
   void draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color& color, int layer);
 
   void draw_line(const Vector& pos1, const Vector& pos2, const Color& color, int layer);
+  /** Draw independent line segments in a single request, each
+      segment is given by two consecutive points */
+  void draw_lines(const std::vector<Vector>& points, const Color& color, int layer);
+
+  /** Draw the lines of a grid in a single request
+   *
+   * @param region Area covered by the grid, its top left corner is
+   *        the intersection of the first column and row line
+   * @param cell_size Size of a single grid cell
+   * @param color Color
+   * @param layer Layer
+   */
+  void draw_grid(const Rectf& region, const Sizef& cell_size, const Color& color, int layer);
   void draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3, const Color& color, int layer);
 
   /** Draw a flat-topped regular hexagon
@@ -104,6 +122,21 @@ private:
   Vector apply_translate(const Vector& pos) const;
   float scale() const;
 
+  /** Returns the most recent request if another quad of the given
+      surface can be appended to it, nullptr otherwise. Consecutive
+      draws of the same surface, e.g. the light sprites of many
+      lanterns, thereby end up in a single draw call. */
+  TextureRequest* get_batchable_request(const Surface& surface, Flip flip,
+                                        const Blend& blend, int layer) const;
+
+  /** Create a request with the given rects copied into the obstack,
+      the angles are left to the caller. */
+  TextureRequest* make_batch_request(const Surface& surface,
+                                     const std::vector<Rectf>& srcrects,
+                                     const std::vector<Rectf>& dstrects,
+                                     const Color& color,
+                                     int layer);
+
 private:
   DrawingContext& m_context;
   obstack& m_obst;
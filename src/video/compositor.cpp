@@ -18,39 +18,111 @@
 #include "video/compositor.hpp"
 
 #include "math/rect.hpp"
+#include "util/profiler.hpp"
 #include "video/drawing_context.hpp"
 #include "video/drawing_request.hpp"
+#include "video/frame_capture.hpp"
 #include "video/painter.hpp"
+#include "video/render_stats.hpp"
 #include "video/renderer.hpp"
 #include "video/video_system.hpp"
 
+namespace {
+
+/** Memory of the drawing requests. A Compositor only lives for a single
+    frame, so the obstack is kept here and rewound after each frame
+    instead of giving its chunks back. */
+class RequestArena final
+{
+private:
+  static const int INITIAL_CHUNK_SIZE = 64 * 1024;
+
+public:
+  RequestArena() :
+    m_obst(),
+    m_base()
+  {
+    begin(INITIAL_CHUNK_SIZE);
+  }
+
+  ~RequestArena()
+  {
+    obstack_free(&m_obst, nullptr);
+  }
+
+  obstack& get() { return m_obst; }
+
+  /** Releases everything allocated since the last rewind. Chunks are
+      only kept up to the one holding m_base, so a frame that didn't fit
+      into the first chunk makes it start over with a bigger one. */
+  void rewind()
+  {
+    const int used = obstack_memory_used(&m_obst);
+    if (used > obstack_chunk_size(&m_obst))
+    {
+      obstack_free(&m_obst, nullptr);
+      begin(used * 2);
+    }
+    else
+    {
+      obstack_free(&m_obst, m_base);
+    }
+  }
+
+private:
+  void begin(int chunk_size)
+  {
+    obstack_begin(&m_obst, chunk_size);
+    m_base = static_cast<char*>(obstack_alloc(&m_obst, 1));
+  }
+
+private:
+  obstack m_obst;
+  char* m_base;
+
+private:
+  RequestArena(const RequestArena&) = delete;
+  RequestArena& operator=(const RequestArena&) = delete;
+};
+
+RequestArena&
+get_request_arena()
+{
+  static RequestArena arena;
+  return arena;
+}
+
+} // namespace
+
 bool Compositor::s_render_lighting = true;
 
-Compositor::Compositor(VideoSystem& video_system, float time_offset) :
+Compositor::Compositor(VideoSystem& video_system, float time_offset, float interpolation) :
   m_video_system(video_system),
-  m_obst(),
+  m_obst(get_request_arena().get()),
   m_drawing_contexts(),
-  m_time_offset(time_offset)
+  m_time_offset(time_offset),
+  m_interpolation(interpolation)
 {
-  obstack_init(&m_obst);
 }
 
 Compositor::~Compositor()
 {
   m_drawing_contexts.clear();
-  obstack_free(&m_obst, nullptr);
+  get_request_arena().rewind();
 }
 
 DrawingContext&
 Compositor::make_context(bool overlay)
 {
-  m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_obst, overlay, m_time_offset));
+  m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_obst, overlay, m_time_offset, m_interpolation));
   return *m_drawing_contexts.back();
 }
 
 void
 Compositor::render()
 {
+  ProfileZone profile_zone("Compositor::render");
+
   auto& lightmap = m_video_system.get_lightmap();
 
   bool use_lightmap = std::any_of(m_drawing_contexts.begin(), m_drawing_contexts.end(),
@@ -63,6 +135,7 @@ Compositor::render()
   // Prepare lightmap.
   if (use_lightmap)
   {
+    m_video_system.begin_gpu_timer(RenderStats::PASS_LIGHTMAP);
     lightmap.start_draw();
     Painter& painter = lightmap.get_painter();
 
@@ -76,11 +149,13 @@ Compositor::render()
       }
     }
     lightmap.end_draw();
+    m_video_system.end_gpu_timer(RenderStats::PASS_LIGHTMAP);
   }
 
   auto back_renderer = m_video_system.get_back_renderer();
   if (back_renderer)
   {
+    m_video_system.begin_gpu_timer(RenderStats::PASS_BACK);
     back_renderer->start_draw();
 
     for (auto& ctx : m_drawing_contexts)
@@ -89,12 +164,14 @@ Compositor::render()
     }
 
     back_renderer->end_draw();
+    m_video_system.end_gpu_timer(RenderStats::PASS_BACK);
   }
 
   // Compose the screen.
   {
     auto& renderer = m_video_system.get_renderer();
 
+    m_video_system.begin_gpu_timer(RenderStats::PASS_SCREEN);
     renderer.start_draw();
 
     for (auto& ctx : m_drawing_contexts)
@@ -108,7 +185,7 @@ Compositor::render()
       if (texture)
       {
         DrawingTransform transform(m_video_system.get_viewport());
-        TextureRequest request(transform);
+        TextureRequest request(transform, m_obst);
 
         request.blend = Blend::MOD;
 
@@ -132,6 +209,7 @@ Compositor::render()
     }
 
     renderer.end_draw();
+    m_video_system.end_gpu_timer(RenderStats::PASS_SCREEN);
   }
 
   // Clean up.
@@ -139,10 +217,11 @@ Compositor::render()
   {
     ctx->clear();
   }
+  m_video_system.get_frame_capture().capture();
   m_video_system.flip();
+  g_render_stats.end_frame();
 
-  obstack_free(&m_obst, nullptr);
-  obstack_init(&m_obst);
+  get_request_arena().rewind();
 }
 
 /* EOF */
@@ -33,7 +33,7 @@ public:
   static bool s_render_lighting;
 
 public:
-  Compositor(VideoSystem& video_system, float time_offset);
+  Compositor(VideoSystem& video_system, float time_offset, float interpolation = 1.0f);
   ~Compositor();
 
   void render();
@@ -47,12 +47,14 @@ public:
 private:
   VideoSystem& m_video_system;
 
-  /* obstack holding the memory of the drawing requests */
-  obstack m_obst;
+  /* obstack holding the memory of the drawing requests, shared by all
+     compositors and rewound once a frame is done */
+  obstack& m_obst;
 
   std::vector<std::unique_ptr<DrawingContext> > m_drawing_contexts;
 
   float m_time_offset;
+  float m_interpolation;
 
 private:
   Compositor(const Compositor&) = delete;
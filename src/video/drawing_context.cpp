@@ -26,7 +26,8 @@
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 
-DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool overlay, float time_offset) :
+DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool overlay, float time_offset,
+                               float interpolation) :
   m_video_system(video_system_),
   m_obst(obst),
   m_overlay(overlay),
@@ -34,7 +35,8 @@ DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool o
   m_transform_stack({ DrawingTransform(m_video_system.get_viewport()) }),
   m_colormap_canvas(*this, m_obst),
   m_lightmap_canvas(*this, m_obst),
-  m_time_offset(time_offset)
+  m_time_offset(time_offset),
+  m_interpolation(interpolation)
 {
 }
 
@@ -42,7 +42,8 @@ struct obstack;
 class DrawingContext final
 {
 public:
-  DrawingContext(VideoSystem& video_system, obstack& obst, bool overlay, float time_offset);
+  DrawingContext(VideoSystem& video_system, obstack& obst, bool overlay, float time_offset,
+                 float interpolation = 1.0f);
   ~DrawingContext();
 
   /** Returns the visible area in world coordinates */
@@ -96,6 +97,12 @@ public:
   inline void set_time_offset(float time_offset) { m_time_offset = time_offset; }
   inline float get_time_offset() const { return m_time_offset; }
 
+  /** For position interpolation at high frame rates: fraction of a
+      game step between the previous (0.0) and the current (1.0)
+      logical state that should be drawn */
+  inline void set_interpolation(float interpolation) { m_interpolation = interpolation; }
+  inline float get_interpolation() const { return m_interpolation; }
+
   void clear();
 
   inline void set_viewport(const Rect& viewport) { transform().viewport = viewport; }
@@ -128,6 +135,7 @@ private:
   Canvas m_lightmap_canvas;
 
   float m_time_offset;
+  float m_interpolation;
 
 private:
   DrawingContext(const DrawingContext&) = delete;
@@ -19,10 +19,12 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "math/rectf.hpp"
 #include "math/sizef.hpp"
 #include "math/vector.hpp"
+#include "util/obstack_vector.hpp"
 #include "video/blend.hpp"
 #include "video/color.hpp"
 #include "video/drawing_transform.hpp"
@@ -33,7 +35,7 @@ class Surface;
 
 enum class RequestType
 {
-  TEXTURE, GRADIENT, FILLRECT, INVERSEELLIPSE, GETPIXEL, LINE, TRIANGLE
+  TEXTURE, GRADIENT, FILLRECT, FILLRECTS, INVERSEELLIPSE, GETPIXEL, LINE, LINES, TRIANGLE
 };
 
 struct DrawingRequest
@@ -57,27 +59,35 @@ struct DrawingRequest
   virtual RequestType get_type() const = 0;
 };
 
+/** The rect, angle and color arrays are allocated from the same
+    obstack as the request itself, so they go away with it at the end
+    of the frame. */
 struct TextureRequest : public DrawingRequest
 {
-  TextureRequest(const DrawingTransform& transform) :
+  TextureRequest(const DrawingTransform& transform, obstack& obst) :
     DrawingRequest(transform),
     texture(),
     displacement_texture(),
-    srcrects(),
-    dstrects(),
-    angles(),
-    color(1.0f, 1.0f, 1.0f)
+    srcrects(obst),
+    dstrects(obst),
+    angles(obst),
+    color(1.0f, 1.0f, 1.0f),
+    colors(obst)
   {}
 
   RequestType get_type() const override { return RequestType::TEXTURE; }
 
   const Texture* texture;
   const Texture* displacement_texture;
-  std::vector<Rectf> srcrects;
-  std::vector<Rectf> dstrects;
-  std::vector<float> angles;
+  ObstackVector<Rectf> srcrects;
+  ObstackVector<Rectf> dstrects;
+  ObstackVector<float> angles;
   Color color;
 
+  /** Per-quad colors, used instead of 'color' when not empty. Filled
+      when surfaces of different color got merged into one request. */
+  ObstackVector<Color> colors;
+
 private:
   TextureRequest(const TextureRequest&) = delete;
   TextureRequest& operator=(const TextureRequest&) = delete;
@@ -121,6 +131,25 @@ struct FillRectRequest : public DrawingRequest
   float radius;
 };
 
+/** The rects are allocated from the same obstack as the request. */
+struct FillRectsRequest : public DrawingRequest
+{
+  FillRectsRequest(const DrawingTransform& transform, obstack& obst) :
+    DrawingRequest(transform),
+    rects(obst),
+    color()
+  {}
+
+  RequestType get_type() const override { return RequestType::FILLRECTS; }
+
+  ObstackVector<Rectf> rects;
+  Color color;
+
+private:
+  FillRectsRequest(const FillRectsRequest&) = delete;
+  FillRectsRequest& operator=(const FillRectsRequest&) = delete;
+};
+
 struct InverseEllipseRequest : public DrawingRequest
 {
   InverseEllipseRequest(const DrawingTransform& transform) :
@@ -153,6 +182,27 @@ struct LineRequest : public DrawingRequest
   Color color;
 };
 
+/** A list of independent line segments, each given by two
+    consecutive points. The points are allocated from the same obstack
+    as the request. */
+struct LinesRequest : public DrawingRequest
+{
+  LinesRequest(const DrawingTransform& transform, obstack& obst) :
+    DrawingRequest(transform),
+    points(obst),
+    color()
+  {}
+
+  RequestType get_type() const override { return RequestType::LINES; }
+
+  ObstackVector<Vector> points;
+  Color color;
+
+private:
+  LinesRequest(const LinesRequest&) = delete;
+  LinesRequest& operator=(const LinesRequest&) = delete;
+};
+
 struct TriangleRequest : public DrawingRequest
 {
   TriangleRequest(const DrawingTransform& transform) :
@@ -0,0 +1,282 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/frame_capture.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <physfs.h>
+#include <sstream>
+
+#include "physfs/util.hpp"
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+#include "video/sdl_surface.hpp"
+#include "video/video_system.hpp"
+
+namespace {
+
+const char* const SCREENSHOTS_DIR = "/screenshots";
+
+} // namespace
+
+FrameCapture::FrameCapture(VideoSystem& video_system) :
+  m_video_system(video_system),
+  m_screenshot_requested(false),
+  m_record_interval(0),
+  m_record_frame(0),
+  m_readbacks(),
+  m_sequence(),
+  m_thread_started(false),
+  m_thread(nullptr),
+  m_mutex(nullptr),
+  m_cond(nullptr),
+  m_jobs(),
+  m_results(),
+  m_quit(false)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+  if (m_thread)
+  {
+    SDL_LockMutex(m_mutex);
+    m_quit = true;
+    SDL_CondSignal(m_cond);
+    SDL_UnlockMutex(m_mutex);
+
+    // The worker finishes the remaining jobs before it returns.
+    SDL_WaitThread(m_thread, nullptr);
+    report_results();
+  }
+
+  if (m_cond)
+    SDL_DestroyCond(m_cond);
+  if (m_mutex)
+    SDL_DestroyMutex(m_mutex);
+}
+
+void
+FrameCapture::request_screenshot()
+{
+  m_screenshot_requested = true;
+}
+
+void
+FrameCapture::set_recording(int interval)
+{
+  m_record_interval = std::max(0, interval);
+  m_record_frame = 0;
+}
+
+void
+FrameCapture::capture()
+{
+  if (m_thread)
+    report_results();
+
+  // Hand over the readbacks that finished in the meantime.
+  while (!m_readbacks.empty())
+  {
+    SDLSurfacePtr surface;
+    if (!m_video_system.finish_readback(surface))
+      break;
+
+    if (surface)
+    {
+      submit(std::move(surface), m_readbacks.front());
+    }
+    else
+    {
+      for (const auto& target : m_readbacks.front())
+        log_warning << "Reading back \"" << target.filename << "\" has failed" << std::endl;
+    }
+    m_readbacks.pop_front();
+  }
+
+  std::vector<Target> targets;
+  if (m_record_interval > 0)
+  {
+    if (m_record_frame % m_record_interval == 0)
+      targets.push_back({ next_filename("frame"), false });
+    m_record_frame += 1;
+  }
+  if (m_screenshot_requested)
+  {
+    m_screenshot_requested = false;
+    targets.push_back({ next_filename("screenshot"), true });
+  }
+
+  if (targets.empty())
+    return;
+
+  if (m_video_system.start_readback())
+  {
+    m_readbacks.push_back(std::move(targets));
+  }
+  else
+  {
+    SDLSurfacePtr surface = m_video_system.make_screenshot();
+    if (!surface)
+    {
+      log_warning << "Creating the screenshot has failed" << std::endl;
+      return;
+    }
+    submit(std::move(surface), targets);
+  }
+}
+
+void
+FrameCapture::submit(SDLSurfacePtr surface, const std::vector<Target>& targets)
+{
+  if (!m_thread_started)
+  {
+    // Only try once, a failure sticks to the synchronous path below.
+    m_thread_started = true;
+    m_mutex = SDL_CreateMutex();
+    m_cond = SDL_CreateCond();
+    if (m_mutex && m_cond)
+      m_thread = SDL_CreateThread(&FrameCapture::worker_main, "FrameCapture", this);
+
+    if (!m_thread)
+      log_warning << "Couldn't start frame capture thread, writing synchronously: " << SDL_GetError() << std::endl;
+  }
+
+  if (!m_thread)
+  {
+    for (const auto& target : targets)
+    {
+      if (SDLSurface::save_png(*surface, target.filename) && target.report)
+        log_info << "Wrote screenshot to \"" << target.filename << "\"" << std::endl;
+    }
+    return;
+  }
+
+  SDL_LockMutex(m_mutex);
+  for (size_t i = 0; i < targets.size(); ++i)
+  {
+    if (m_jobs.size() >= MAX_PENDING_JOBS)
+    {
+      log_warning << "Frame capture is falling behind, dropping \"" << targets[i].filename << "\"" << std::endl;
+      continue;
+    }
+
+    // All but the last target get their own copy of the frame.
+    SDLSurfacePtr job_surface;
+    if (i + 1 < targets.size())
+      job_surface.reset(SDL_ConvertSurface(surface.get(), surface->format, 0));
+    else
+      job_surface = std::move(surface);
+
+    if (!job_surface)
+      continue;
+
+    m_jobs.push_back({ std::move(job_surface), targets[i].filename, targets[i].report });
+  }
+  SDL_CondSignal(m_cond);
+  SDL_UnlockMutex(m_mutex);
+}
+
+std::string
+FrameCapture::next_filename(const std::string& prefix)
+{
+  auto it = m_sequence.find(prefix);
+  if (it == m_sequence.end())
+  {
+    if (!PHYSFS_exists(SCREENSHOTS_DIR) && !PHYSFS_mkdir(SCREENSHOTS_DIR))
+      log_warning << "Creating '" << SCREENSHOTS_DIR << "' failed" << std::endl;
+
+    // Continue after the highest number that is already taken.
+    int next = 0;
+    physfsutil::enumerate_files(SCREENSHOTS_DIR, [&prefix, &next](const std::string& filename) {
+      if (filename.size() == prefix.size() + 10 &&
+          filename.compare(0, prefix.size(), prefix) == 0 &&
+          filename.compare(filename.size() - 4, 4, ".png") == 0)
+      {
+        const std::string digits = filename.substr(prefix.size(), 6);
+        if (digits.find_first_not_of("0123456789") == std::string::npos)
+          next = std::max(next, std::stoi(digits) + 1);
+      }
+      return false;
+    });
+
+    it = m_sequence.emplace(prefix, next).first;
+  }
+
+  std::ostringstream oss;
+  oss << prefix << std::setw(6) << std::setfill('0') << it->second << ".png";
+  it->second += 1;
+
+  return FileSystem::join(SCREENSHOTS_DIR, oss.str());
+}
+
+int
+FrameCapture::worker_main(void* data)
+{
+  static_cast<FrameCapture*>(data)->run_worker();
+  return 0;
+}
+
+void
+FrameCapture::run_worker()
+{
+  SDL_LockMutex(m_mutex);
+  while (true)
+  {
+    while (m_jobs.empty() && !m_quit)
+      SDL_CondWait(m_cond, m_mutex);
+
+    if (m_jobs.empty())
+      break;
+
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    SDL_UnlockMutex(m_mutex);
+
+    // The log isn't thread-safe, results are reported by the main thread.
+    std::string error;
+    const bool success = SDLSurface::save_png(*job.surface, job.filename, error);
+
+    SDL_LockMutex(m_mutex);
+    if (!success)
+      m_results.push_back({ false, error });
+    else if (job.report)
+      m_results.push_back({ true, "Wrote screenshot to \"" + job.filename + "\"" });
+  }
+  SDL_UnlockMutex(m_mutex);
+}
+
+void
+FrameCapture::report_results()
+{
+  std::vector<Result> results;
+
+  SDL_LockMutex(m_mutex);
+  results.swap(m_results);
+  SDL_UnlockMutex(m_mutex);
+
+  for (const auto& result : results)
+  {
+    if (result.success)
+      log_info << result.message << std::endl;
+    else
+      log_warning << result.message << std::endl;
+  }
+}
+
+/* EOF */
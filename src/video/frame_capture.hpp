@@ -0,0 +1,119 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_VIDEO_FRAME_CAPTURE_HPP
+#define HEADER_SUPERTUX_VIDEO_FRAME_CAPTURE_HPP
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+#include "video/sdl_surface_ptr.hpp"
+
+class VideoSystem;
+
+/** Takes screenshots and records image sequences of the rendered
+    frames without stalling the game. Frames are read back
+    asynchronously where the video system supports it, the PNG encoding
+    and writing happens on a worker thread. */
+class FrameCapture final
+{
+private:
+  /** Number of frames that may wait for encoding before new captures
+      are dropped */
+  static constexpr size_t MAX_PENDING_JOBS = 16;
+
+  struct Target
+  {
+    std::string filename;
+
+    /** Log the filename once written, off for recorded frames */
+    bool report;
+  };
+
+  struct Job
+  {
+    SDLSurfacePtr surface;
+    std::string filename;
+    bool report;
+  };
+
+  struct Result
+  {
+    bool success;
+    std::string message;
+  };
+
+public:
+  FrameCapture(VideoSystem& video_system);
+  ~FrameCapture();
+
+  /** Capture the next frame to /screenshots/screenshotNNNNNN.png */
+  void request_screenshot();
+
+  /** Capture every \a interval-th frame to /screenshots/frameNNNNNN.png,
+      0 stops the recording */
+  void set_recording(int interval);
+  inline int get_recording() const { return m_record_interval; }
+
+  /** Called once per frame after everything has been drawn and before
+      the video system flips the buffers */
+  void capture();
+
+private:
+  static int worker_main(void* data);
+  void run_worker();
+
+  void submit(SDLSurfacePtr surface, const std::vector<Target>& targets);
+  std::string next_filename(const std::string& prefix);
+  void report_results();
+
+private:
+  VideoSystem& m_video_system;
+
+  bool m_screenshot_requested;
+  int m_record_interval;
+  int m_record_frame;
+
+  /** Targets of the readbacks that are still in flight, oldest first */
+  std::deque<std::vector<Target>> m_readbacks;
+
+  /** Next free number for each filename prefix, the directory is only
+      scanned on first use */
+  std::map<std::string, int> m_sequence;
+
+  /** Set once the worker has been tried, m_thread stays null if that failed */
+  bool m_thread_started;
+  SDL_Thread* m_thread;
+  SDL_mutex* m_mutex;
+  SDL_cond* m_cond;
+
+  /** Guarded by m_mutex */
+  std::deque<Job> m_jobs;
+  std::vector<Result> m_results;
+  bool m_quit;
+
+private:
+  FrameCapture(const FrameCapture&) = delete;
+  FrameCapture& operator=(const FrameCapture&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -20,6 +20,7 @@
 #include "video/glutil.hpp"
 #include "video/color.hpp"
 #include "video/gl/gl_texture.hpp"
+#include "video/render_stats.hpp"
 
 #ifndef USE_OPENGLES2
 
@@ -77,6 +78,7 @@ GL20Context::blend_func(GLenum src, GLenum dst)
   assert_gl();
 
   glBlendFunc(src, dst);
+  g_render_stats.count_blend(static_cast<int>(src), static_cast<int>(dst));
 
   assert_gl();
 }
@@ -88,6 +90,7 @@ GL20Context::set_positions(const float* data, size_t size)
 
   glEnableClientState(GL_VERTEX_ARRAY);
   glVertexPointer(2, GL_FLOAT, 0, data);
+  g_render_stats.count_upload(size);
 
   assert_gl();
 }
@@ -99,6 +102,7 @@ GL20Context::set_texcoords(const float* data, size_t size)
 
   glEnableClientState(GL_TEXTURE_COORD_ARRAY);
   glTexCoordPointer(2, GL_FLOAT, 0, data);
+  g_render_stats.count_upload(size);
 
   assert_gl();
 }
@@ -120,6 +124,7 @@ GL20Context::set_colors(const float* data, size_t size)
 
   glEnableClientState(GL_COLOR_ARRAY);
   glColorPointer(4, GL_FLOAT, 0, data);
+  g_render_stats.count_upload(size);
 
   assert_gl();
 }
@@ -142,6 +147,7 @@ GL20Context::bind_texture(const Texture& texture, const Texture* displacement_te
 
   glEnable(GL_TEXTURE_2D);
   glBindTexture(GL_TEXTURE_2D, static_cast<const GLTexture&>(texture).get_handle());
+  g_render_stats.count_texture_bind(&texture);
 
   assert_gl();
 
@@ -174,6 +180,7 @@ GL20Context::bind_no_texture()
   assert_gl();
 
   glDisable(GL_TEXTURE_2D);
+  g_render_stats.count_texture_bind(nullptr);
 
   assert_gl();
 }
@@ -184,6 +191,7 @@ GL20Context::draw_arrays(GLenum type, GLint first, GLsizei count)
   assert_gl();
 
   glDrawArrays(type, first, count);
+  g_render_stats.count_draw_call(count);
 
   assert_gl();
 }
@@ -24,6 +24,7 @@
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
+#include "video/render_stats.hpp"
 
 GL33CoreContext::GL33CoreContext(GLVideoSystem& video_system) :
   m_video_system(video_system),
@@ -140,6 +141,7 @@ GL33CoreContext::blend_func(GLenum src, GLenum dst)
   assert_gl();
 
   glBlendFunc(src, dst);
+  g_render_stats.count_blend(static_cast<int>(src), static_cast<int>(dst));
 
   assert_gl();
 }
@@ -148,12 +150,14 @@ void
 GL33CoreContext::set_positions(const float* data, size_t size)
 {
   m_vertex_arrays->set_positions(data, size);
+  g_render_stats.count_upload(size);
 }
 
 void
 GL33CoreContext::set_texcoords(const float* data, size_t size)
 {
   m_vertex_arrays->set_texcoords(data, size);
+  g_render_stats.count_upload(size);
 }
 
 void
@@ -166,6 +170,7 @@ void
 GL33CoreContext::set_colors(const float* data, size_t size)
 {
   m_vertex_arrays->set_colors(data, size);
+  g_render_stats.count_upload(size);
 }
 
 void
@@ -179,6 +184,8 @@ GL33CoreContext::bind_texture(const Texture& texture, const Texture* displacemen
 {
   assert_gl();
 
+  g_render_stats.count_texture_bind(&texture);
+
   GLTextureRenderer* back_renderer = static_cast<GLTextureRenderer*>(m_video_system.get_back_renderer());
 
   if (displacement_texture && back_renderer->is_rendering())
@@ -225,6 +232,8 @@ GL33CoreContext::bind_no_texture()
 {
   assert_gl();
 
+  g_render_stats.count_texture_bind(nullptr);
+
   glActiveTexture(GL_TEXTURE0);
   glBindTexture(GL_TEXTURE_2D, m_white_texture->get_handle());
 
@@ -240,6 +249,7 @@ GL33CoreContext::draw_arrays(GLenum type, GLint first, GLsizei count)
   assert_gl();
 
   glDrawArrays(type, first, count);
+  g_render_stats.count_draw_call(count);
 
   assert_gl();
 }
@@ -63,7 +63,8 @@ GLPainter::GLPainter(GLVideoSystem& video_system, GLRenderer& renderer) :
   m_video_system(video_system),
   m_renderer(renderer),
   m_vertices(),
-  m_uvs()
+  m_uvs(),
+  m_colors()
 {
 }
 
@@ -170,10 +171,32 @@ GLPainter::draw_texture(const TextureRequest& request)
   context.bind_texture(texture, request.displacement_texture);
   context.set_texcoords(m_uvs.data(), sizeof(float) * m_uvs.size());
   context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
-  context.set_color(Color(request.color.red,
-                          request.color.green,
-                          request.color.blue,
-                          request.color.alpha * request.alpha));
+
+  if (request.colors.empty())
+  {
+    context.set_color(Color(request.color.red,
+                            request.color.green,
+                            request.color.blue,
+                            request.color.alpha * request.alpha));
+  }
+  else
+  {
+    assert(request.colors.size() == request.srcrects.size());
+
+    m_colors.clear();
+    m_colors.reserve(request.colors.size() * 24);
+    for (const auto& color : request.colors)
+    {
+      for (int i = 0; i < 6; ++i)
+      {
+        m_colors.push_back(color.red);
+        m_colors.push_back(color.green);
+        m_colors.push_back(color.blue);
+        m_colors.push_back(color.alpha * request.alpha);
+      }
+    }
+    context.set_colors(m_colors.data(), sizeof(float) * m_colors.size());
+  }
 
   context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(request.srcrects.size() * 2 * 3));
 
@@ -311,6 +334,46 @@ GLPainter::draw_filled_rect(const FillRectRequest& request)
   assert_gl();
 }
 
+void
+GLPainter::draw_filled_rects(const FillRectsRequest& request)
+{
+  assert_gl();
+
+  m_vertices.clear();
+  m_vertices.reserve(request.rects.size() * 12);
+
+  for (const auto& rect : request.rects)
+  {
+    const float x1 = rect.get_left();
+    const float y1 = rect.get_top();
+    const float x2 = rect.get_right();
+    const float y2 = rect.get_bottom();
+
+    const float vertices[] = {
+      x1, y1,
+      x2, y1,
+      x2, y2,
+
+      x1, y1,
+      x2, y2,
+      x1, y2
+    };
+    m_vertices.insert(m_vertices.end(), std::begin(vertices), std::end(vertices));
+  }
+
+  GLContext& context = m_video_system.get_context();
+
+  context.blend_func(sfactor(request.blend), dfactor(request.blend));
+  context.bind_no_texture();
+  context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
+  context.set_texcoord(0.0f, 0.0f);
+  context.set_color(request.color);
+
+  context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_vertices.size() / 2));
+
+  assert_gl();
+}
+
 void
 GLPainter::draw_inverse_ellipse(const InverseEllipseRequest& request)
 {
@@ -436,6 +499,66 @@ GLPainter::draw_line(const LineRequest& request)
   assert_gl();
 }
 
+void
+GLPainter::draw_lines(const LinesRequest& request)
+{
+  assert_gl();
+
+  const Vector viewport_scale = m_video_system.get_viewport().get_scale();
+
+  m_vertices.clear();
+  m_vertices.reserve(request.points.size() / 2 * 12);
+
+  // Same as draw_line(), but each quad is emitted as two separate
+  // triangles so that all lines go out in a single draw call.
+  for (size_t i = 0; i + 1 < request.points.size(); i += 2)
+  {
+    const float& x1 = request.points[i].x;
+    const float& y1 = request.points[i].y;
+    const float& x2 = request.points[i + 1].x;
+    const float& y2 = request.points[i + 1].y;
+
+    float x_step = (y2 - y1);
+    float y_step = -(x2 - x1);
+
+    const float step_norm = sqrtf(x_step * x_step + y_step * y_step);
+    if (step_norm == 0.0f)
+      continue;
+
+    x_step /= step_norm * viewport_scale.x;
+    y_step /= step_norm * viewport_scale.y;
+
+    x_step *= 0.5f;
+    y_step *= 0.5f;
+
+    const float vertices[] = {
+      (x1 - x_step), (y1 - y_step),
+      (x2 - x_step), (y2 - y_step),
+      (x1 + x_step), (y1 + y_step),
+
+      (x2 - x_step), (y2 - y_step),
+      (x1 + x_step), (y1 + y_step),
+      (x2 + x_step), (y2 + y_step),
+    };
+    m_vertices.insert(m_vertices.end(), std::begin(vertices), std::end(vertices));
+  }
+
+  if (m_vertices.empty())
+    return;
+
+  GLContext& context = m_video_system.get_context();
+
+  context.blend_func(sfactor(request.blend), dfactor(request.blend));
+  context.bind_no_texture();
+  context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
+  context.set_texcoord(0.0f, 0.0f);
+  context.set_color(request.color);
+
+  context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_vertices.size() / 2));
+
+  assert_gl();
+}
+
 void
 GLPainter::draw_triangle(const TriangleRequest& request)
 {
@@ -0,0 +1,158 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/gl/gl_readback.hpp"
+
+#include <string.h>
+
+#include "video/glutil.hpp"
+#include "video/sdl_surface.hpp"
+
+#if !defined(USE_OPENGLES2) && !defined(USE_OPENGLES1)
+
+GLReadback::GLReadback() :
+  m_slots(),
+  m_issued(0),
+  m_read(0)
+{
+}
+
+GLReadback::~GLReadback()
+{
+  for (auto& slot : m_slots)
+  {
+    if (slot.buffer)
+      glDeleteBuffers(1, &slot.buffer);
+  }
+}
+
+bool
+GLReadback::start(int x, int y, int width, int height)
+{
+  if (m_issued - m_read >= BUFFER_COUNT)
+    return false;
+
+  assert_gl();
+
+  Slot& slot = m_slots[m_issued % BUFFER_COUNT];
+  if (!slot.buffer)
+    glGenBuffers(1, &slot.buffer);
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+
+  const int size = 3 * width * height;
+  if (slot.size != size)
+  {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    slot.size = size;
+  }
+
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  assert_gl();
+
+  slot.width = width;
+  slot.height = height;
+  slot.age = 0;
+  m_issued += 1;
+
+  return true;
+}
+
+bool
+GLReadback::finish(SDLSurfacePtr& surface)
+{
+  if (m_read == m_issued)
+    return false;
+
+  Slot& slot = m_slots[m_read % BUFFER_COUNT];
+  if (slot.age < LATENCY)
+    return false;
+
+  assert_gl();
+
+  m_read += 1;
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+  const char* pixels = static_cast<const char*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+  if (!pixels)
+  {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return true;
+  }
+
+  surface = SDLSurface::create_rgb(slot.width, slot.height);
+
+  SDL_LockSurface(surface.get());
+  for (int i = 0; i < slot.height; i++)
+  {
+    const char* src = &pixels[3 * slot.width * (slot.height - i - 1)];
+    char* dst = (static_cast<char*>(surface->pixels)) + i * surface->pitch;
+    memcpy(dst, src, 3 * slot.width);
+  }
+  SDL_UnlockSurface(surface.get());
+
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  assert_gl();
+
+  return true;
+}
+
+void
+GLReadback::on_flip()
+{
+  for (unsigned int i = m_read; i != m_issued; ++i)
+    m_slots[i % BUFFER_COUNT].age += 1;
+}
+
+#else
+
+GLReadback::GLReadback() :
+  m_slots(),
+  m_issued(0),
+  m_read(0)
+{
+}
+
+GLReadback::~GLReadback()
+{
+}
+
+bool
+GLReadback::start(int x, int y, int width, int height)
+{
+  return false;
+}
+
+bool
+GLReadback::finish(SDLSurfacePtr& surface)
+{
+  return false;
+}
+
+void
+GLReadback::on_flip()
+{
+}
+
+#endif
+
+/* EOF */
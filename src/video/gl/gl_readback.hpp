@@ -0,0 +1,72 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_VIDEO_GL_GL_READBACK_HPP
+#define HEADER_SUPERTUX_VIDEO_GL_GL_READBACK_HPP
+
+#include "video/gl.hpp"
+#include "video/sdl_surface_ptr.hpp"
+
+/** Reads the framebuffer into pixel buffer objects, the copy is
+    picked up a few frames later when the GPU is done with it, so that
+    taking a screenshot never stalls the pipeline. */
+class GLReadback final
+{
+private:
+  static constexpr unsigned int BUFFER_COUNT = 3;
+
+  /** Number of flips before a buffer is mapped */
+  static constexpr int LATENCY = 2;
+
+  struct Slot
+  {
+    GLuint buffer;
+    int size;
+    int width;
+    int height;
+    int age;
+  };
+
+public:
+  GLReadback();
+  ~GLReadback();
+
+  /** Start reading back the given area of the current framebuffer,
+      returns false if all buffers are still in flight. */
+  bool start(int x, int y, int width, int height);
+
+  /** Returns true once the oldest readback is old enough to be mapped
+      without waiting for the GPU, surface stays empty if mapping it
+      failed. The readback is consumed either way. */
+  bool finish(SDLSurfacePtr& surface);
+
+  /** Called after each buffer flip */
+  void on_flip();
+
+private:
+  Slot m_slots[BUFFER_COUNT];
+  unsigned int m_issued;
+  unsigned int m_read;
+
+private:
+  GLReadback(const GLReadback&) = delete;
+  GLReadback& operator=(const GLReadback&) = delete;
+};
+
+#endif
+
+/* EOF */
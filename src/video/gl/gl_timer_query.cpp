@@ -0,0 +1,125 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/gl/gl_timer_query.hpp"
+
+#include "video/glutil.hpp"
+
+#if !defined(USE_OPENGLES2) && !defined(USE_OPENGLES1)
+
+GLTimerQuery::GLTimerQuery() :
+  m_queries(),
+  m_issued(0),
+  m_read(0)
+{
+  assert_gl();
+
+  glGenQueries(QUERY_COUNT, m_queries);
+
+  assert_gl();
+}
+
+GLTimerQuery::~GLTimerQuery()
+{
+  glDeleteQueries(QUERY_COUNT, m_queries);
+}
+
+void
+GLTimerQuery::begin()
+{
+  assert_gl();
+
+  // Drop the oldest result if it still hasn't been read.
+  if (m_issued - m_read >= QUERY_COUNT)
+    m_read = m_issued - QUERY_COUNT + 1;
+
+  glBeginQuery(GL_TIME_ELAPSED, m_queries[m_issued % QUERY_COUNT]);
+
+  assert_gl();
+}
+
+void
+GLTimerQuery::end()
+{
+  assert_gl();
+
+  glEndQuery(GL_TIME_ELAPSED);
+  m_issued += 1;
+
+  assert_gl();
+}
+
+bool
+GLTimerQuery::poll(float& ms)
+{
+  assert_gl();
+
+  bool result = false;
+  while (m_read != m_issued)
+  {
+    const GLuint query = m_queries[m_read % QUERY_COUNT];
+
+    GLint available = 0;
+    glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      break;
+
+    GLuint64 elapsed_ns = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed_ns);
+
+    ms = static_cast<float>(elapsed_ns) / 1000000.0f;
+    result = true;
+    m_read += 1;
+  }
+
+  assert_gl();
+
+  return result;
+}
+
+#else
+
+GLTimerQuery::GLTimerQuery() :
+  m_queries(),
+  m_issued(0),
+  m_read(0)
+{
+}
+
+GLTimerQuery::~GLTimerQuery()
+{
+}
+
+void
+GLTimerQuery::begin()
+{
+}
+
+void
+GLTimerQuery::end()
+{
+}
+
+bool
+GLTimerQuery::poll(float& ms)
+{
+  return false;
+}
+
+#endif
+
+/* EOF */
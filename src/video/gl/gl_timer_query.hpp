@@ -0,0 +1,54 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_VIDEO_GL_GL_TIMER_QUERY_HPP
+#define HEADER_SUPERTUX_VIDEO_GL_GL_TIMER_QUERY_HPP
+
+#include "video/gl.hpp"
+
+/** Measures the GPU time of the commands issued between begin() and
+    end(). Several queries are kept in flight so that reading the
+    results never stalls the pipeline. */
+class GLTimerQuery final
+{
+private:
+  static constexpr unsigned int QUERY_COUNT = 4;
+
+public:
+  GLTimerQuery();
+  ~GLTimerQuery();
+
+  void begin();
+  void end();
+
+  /** Collect the results of all finished queries, returns true and
+      the most recent GPU time in milliseconds if there were any. */
+  bool poll(float& ms);
+
+private:
+  GLuint m_queries[QUERY_COUNT];
+  unsigned int m_issued;
+  unsigned int m_read;
+
+private:
+  GLTimerQuery(const GLTimerQuery&) = delete;
+  GLTimerQuery& operator=(const GLTimerQuery&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -28,6 +28,8 @@
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
+#include "video/gl/gl_readback.hpp"
+#include "video/gl/gl_timer_query.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/glutil.hpp"
 #include "video/sdl_surface.hpp"
@@ -48,7 +50,11 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core, bool auto_opengl_version) :
   m_back_renderer(),
   m_context(),
   m_glcontext(),
-  m_viewport()
+  m_viewport(),
+  m_supports_timer_query(false),
+  m_timer_queries(),
+  m_supports_readback(false),
+  m_readback()
 {
   create_gl_window();
 
@@ -93,6 +99,24 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core, bool auto_opengl_version) :
 
   assert_gl();
 
+  // Timer queries are core since OpenGL 3.3 and not available in GLES2.
+#if defined(USE_OPENGLES2) || defined(USE_OPENGLES1)
+  m_supports_timer_query = false;
+#elif defined(USE_GLBINDING)
+  m_supports_timer_query = m_use_opengl33core;
+#else
+  m_supports_timer_query = m_use_opengl33core || GLEW_ARB_timer_query;
+#endif
+
+  // Pixel buffer objects are core since OpenGL 2.1.
+#if defined(USE_OPENGLES2) || defined(USE_OPENGLES1)
+  m_supports_readback = false;
+#elif defined(USE_GLBINDING)
+  m_supports_readback = m_use_opengl33core;
+#else
+  m_supports_readback = m_use_opengl33core || GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object;
+#endif
+
   m_texture_manager.reset(new TextureManager);
 
   assert_gl();
@@ -106,6 +130,10 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core, bool auto_opengl_version) :
 
 GLVideoSystem::~GLVideoSystem()
 {
+  for (auto& query : m_timer_queries)
+    query.reset();
+  m_readback.reset();
+
   SDL_GL_DeleteContext(m_glcontext);
 }
 
@@ -270,7 +298,7 @@ GLVideoSystem::apply_config()
   m_viewport = Viewport::from_size(g_config->window_size, g_config->window_size);
 #endif
 
-  m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 5));
+  m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), g_config->lightmap_downscale));
   if (m_use_opengl33core)
   {
     m_back_renderer.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 1));
@@ -306,6 +334,9 @@ GLVideoSystem::flip()
 {
   assert_gl();
   SDL_GL_SwapWindow(m_sdl_window.get());
+
+  if (m_readback)
+    m_readback->on_flip();
 }
 
 void
@@ -377,4 +408,55 @@ GLVideoSystem::make_screenshot()
   return surface;
 }
 
+bool
+GLVideoSystem::start_readback()
+{
+  if (!m_supports_readback)
+    return false;
+
+  if (!m_readback)
+    m_readback = std::make_unique<GLReadback>();
+
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+
+  return m_readback->start(viewport[0], viewport[1], viewport[2], viewport[3]);
+}
+
+bool
+GLVideoSystem::finish_readback(SDLSurfacePtr& surface)
+{
+  if (!m_readback)
+    return false;
+
+  return m_readback->finish(surface);
+}
+
+void
+GLVideoSystem::begin_gpu_timer(RenderStats::Pass pass)
+{
+  if (!m_supports_timer_query)
+    return;
+
+  auto& query = m_timer_queries[pass];
+  if (!query)
+    query = std::make_unique<GLTimerQuery>();
+
+  query->begin();
+}
+
+void
+GLVideoSystem::end_gpu_timer(RenderStats::Pass pass)
+{
+  auto& query = m_timer_queries[pass];
+  if (!query)
+    return;
+
+  query->end();
+
+  float ms;
+  if (query->poll(ms))
+    g_render_stats.set_gpu_time(pass, ms);
+}
+
 /* EOF */
@@ -17,6 +17,7 @@
 #ifndef HEADER_SUPERTUX_VIDEO_GL_GL_VIDEO_SYSTEM_HPP
 #define HEADER_SUPERTUX_VIDEO_GL_GL_VIDEO_SYSTEM_HPP
 
+#include <array>
 #include <memory>
 #include <SDL.h>
 
@@ -27,9 +28,11 @@
 class GLContext;
 class GLLightmap;
 class GLProgram;
+class GLReadback;
 class GLScreenRenderer;
 class GLTexture;
 class GLTextureRenderer;
+class GLTimerQuery;
 class GLVertexArrays;
 class Rect;
 class TextureManager;
@@ -57,6 +60,11 @@ public:
   virtual int get_vsync() const override;
 
   virtual SDLSurfacePtr make_screenshot() override;
+  virtual bool start_readback() override;
+  virtual bool finish_readback(SDLSurfacePtr& surface) override;
+
+  virtual void begin_gpu_timer(RenderStats::Pass pass) override;
+  virtual void end_gpu_timer(RenderStats::Pass pass) override;
 
   inline GLContext& get_context() const { return *m_context; }
 
@@ -75,6 +83,12 @@ private:
   SDL_GLContext m_glcontext;
   Viewport m_viewport;
 
+  bool m_supports_timer_query;
+  std::array<std::unique_ptr<GLTimerQuery>, RenderStats::PASS_COUNT> m_timer_queries;
+
+  bool m_supports_readback;
+  std::unique_ptr<GLReadback> m_readback;
+
 private:
   GLVideoSystem(const GLVideoSystem&) = delete;
   GLVideoSystem& operator=(const GLVideoSystem&) = delete;
@@ -45,6 +45,12 @@ NullPainter::draw_filled_rect(const FillRectRequest& request)
   log_info << "NullPainter::draw_filled_rect()" << std::endl;
 }
 
+void
+NullPainter::draw_filled_rects(const FillRectsRequest& request)
+{
+  log_info << "NullPainter::draw_filled_rects()" << std::endl;
+}
+
 void
 NullPainter::draw_inverse_ellipse(const InverseEllipseRequest& request)
 {
@@ -57,6 +63,12 @@ NullPainter::draw_line(const LineRequest& request)
   log_info << "NullPainter::draw_line()" << std::endl;
 }
 
+void
+NullPainter::draw_lines(const LinesRequest& request)
+{
+  log_info << "NullPainter::draw_lines()" << std::endl;
+}
+
 void
 NullPainter::draw_triangle(const TriangleRequest& request)
 {
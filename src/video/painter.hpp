@@ -25,10 +25,12 @@
 class Rect;
 struct DrawingRequest;
 struct FillRectRequest;
+struct FillRectsRequest;
 struct GetPixelRequest;
 struct GradientRequest;
 struct InverseEllipseRequest;
 struct LineRequest;
+struct LinesRequest;
 struct TextureBatchRequest;
 struct TextureRequest;
 struct TriangleRequest;
@@ -42,8 +44,10 @@ public:
   virtual void draw_texture(const TextureRequest& request) = 0;
   virtual void draw_gradient(const GradientRequest& request) = 0;
   virtual void draw_filled_rect(const FillRectRequest& request) = 0;
+  virtual void draw_filled_rects(const FillRectsRequest& request) = 0;
   virtual void draw_inverse_ellipse(const InverseEllipseRequest& request) = 0;
   virtual void draw_line(const LineRequest& request) = 0;
+  virtual void draw_lines(const LinesRequest& request) = 0;
   virtual void draw_triangle(const TriangleRequest& request) = 0;
 
   virtual void clear(const Color& color) = 0;
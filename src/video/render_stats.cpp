@@ -0,0 +1,80 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/render_stats.hpp"
+
+#include <sstream>
+
+RenderStats g_render_stats;
+
+const char*
+RenderStats::get_pass_name(Pass pass)
+{
+  switch (pass)
+  {
+    case PASS_LIGHTMAP: return "lightmap";
+    case PASS_BACK: return "back";
+    case PASS_SCREEN: return "screen";
+    default: return "unknown";
+  }
+}
+
+RenderStats::RenderStats() :
+  m_current(),
+  m_last(),
+  m_last_texture(nullptr),
+  m_last_blend_src(-1),
+  m_last_blend_dst(-1),
+  m_gpu_time_ms()
+{
+  for (auto& ms : m_gpu_time_ms)
+    ms = -1.0f;
+}
+
+void
+RenderStats::end_frame()
+{
+  m_last = m_current;
+  m_current = Counters();
+
+  // State isn't guaranteed to survive the buffer swap, so the first
+  // bind and blend of a frame always count.
+  m_last_texture = nullptr;
+  m_last_blend_src = -1;
+  m_last_blend_dst = -1;
+}
+
+std::string
+RenderStats::to_string() const
+{
+  std::ostringstream out;
+  out << "draw calls: " << m_last.draw_calls
+      << ", texture binds: " << m_last.texture_binds
+      << ", blend changes: " << m_last.blend_changes
+      << ", vertices: " << m_last.vertices
+      << ", uploaded: " << m_last.bytes_uploaded / 1024 << " KiB";
+
+  for (int pass = 0; pass < PASS_COUNT; ++pass)
+  {
+    if (m_gpu_time_ms[pass] >= 0.0f)
+      out << ", " << get_pass_name(static_cast<Pass>(pass)) << ": " << m_gpu_time_ms[pass] << " ms";
+  }
+
+  return out.str();
+}
+
+/* EOF */
@@ -0,0 +1,113 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_VIDEO_RENDER_STATS_HPP
+#define HEADER_SUPERTUX_VIDEO_RENDER_STATS_HPP
+
+#include <stddef.h>
+#include <string>
+
+/** Per-frame counters of the work submitted by the renderer
+    backends, used to spot batching regressions. */
+class RenderStats final
+{
+public:
+  enum Pass
+  {
+    PASS_LIGHTMAP,
+    PASS_BACK,
+    PASS_SCREEN,
+    PASS_COUNT
+  };
+
+  struct Counters
+  {
+    int draw_calls = 0;
+    int texture_binds = 0;
+    int blend_changes = 0;
+    int vertices = 0;
+    size_t bytes_uploaded = 0;
+  };
+
+public:
+  static const char* get_pass_name(Pass pass);
+
+public:
+  RenderStats();
+
+  inline void count_draw_call(int vertices)
+  {
+    m_current.draw_calls += 1;
+    m_current.vertices += vertices;
+  }
+
+  /** Counts a bind only if the texture differs from the last one. */
+  inline void count_texture_bind(const void* texture)
+  {
+    if (texture != m_last_texture)
+    {
+      m_current.texture_binds += 1;
+      m_last_texture = texture;
+    }
+  }
+
+  /** Counts a change only if the blend mode differs from the last one. */
+  inline void count_blend(int src, int dst)
+  {
+    if (src != m_last_blend_src || dst != m_last_blend_dst)
+    {
+      m_current.blend_changes += 1;
+      m_last_blend_src = src;
+      m_last_blend_dst = dst;
+    }
+  }
+
+  inline void count_upload(size_t bytes) { m_current.bytes_uploaded += bytes; }
+
+  /** Make the counters of the current frame available through
+      get_last_frame() and start counting from zero. */
+  void end_frame();
+
+  inline const Counters& get_last_frame() const { return m_last; }
+
+  /** Set by the video system once a GPU timer query of a pass
+      completed, which lags a few frames behind. */
+  inline void set_gpu_time(Pass pass, float ms) { m_gpu_time_ms[pass] = ms; }
+
+  /** GPU time of the pass in milliseconds, negative if unknown */
+  inline float get_gpu_time(Pass pass) const { return m_gpu_time_ms[pass]; }
+
+  std::string to_string() const;
+
+private:
+  Counters m_current;
+  Counters m_last;
+  const void* m_last_texture;
+  int m_last_blend_src;
+  int m_last_blend_dst;
+  float m_gpu_time_ms[PASS_COUNT];
+
+private:
+  RenderStats(const RenderStats&) = delete;
+  RenderStats& operator=(const RenderStats&) = delete;
+};
+
+extern RenderStats g_render_stats;
+
+#endif
+
+/* EOF */
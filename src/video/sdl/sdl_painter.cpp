@@ -21,11 +21,15 @@
 #include <array>
 #include <assert.h>
 #include <math.h>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "supertux/globals.hpp"
 #include "math/util.hpp"
 #include "util/log.hpp"
 #include "video/drawing_request.hpp"
+#include "video/render_stats.hpp"
 #include "video/renderer.hpp"
 #include "video/sdl/sdl_texture.hpp"
 #include "video/sdl/sdl_video_system.hpp"
@@ -108,20 +112,21 @@ Rectf relative_map(const Rectf& inside, const Rect& srcrect, const Rectf& dstrec
   return result;
 }
 
-void render_texture(SDL_Renderer* renderer,
-                    SDL_Texture* texture, const Rectf& imgrect,
-                    const Rect& srcrect, const Rectf& dstrect)
+/* Calls emit(srcrect, dstrect) for each of the pieces srcrect has to
+   be split into to stay inside of imgrect, wrapping around at its
+   edges */
+template<typename F>
+void split_wrapped(const Rectf& imgrect, const Rect& srcrect, const Rectf& dstrect,
+                   const F& emit)
 {
   assert(imgrect.contains(Vector(srcrect.get_left(), srcrect.get_top())));
 
   if (srcrect.empty() || dstrect.empty())
     return;
 
-  if (imgrect.overlaps(srcrect))
+  if (Rect(imgrect).contains(srcrect))
   {
-    SDL_Rect sdl_srcrect = srcrect.to_sdl();
-    SDL_FRect sdl_dstrect = dstrect.to_sdl();
-    SDL_RenderCopyF(renderer, texture, &sdl_srcrect, &sdl_dstrect);
+    emit(srcrect, dstrect);
   }
   else
   {
@@ -129,7 +134,7 @@ void render_texture(SDL_Renderer* renderer,
     std::array<Rectf, 4> rest;
     std::tie(inside, rest[0], rest[1], rest[2], rest[3]) = intersect(srcrect, imgrect);
 
-    render_texture(renderer, texture, imgrect, inside.to_rect(), relative_map(inside, srcrect, dstrect));
+    split_wrapped(imgrect, inside.to_rect(), relative_map(inside, srcrect, dstrect), emit);
 
     for (const Rectf& rectf : rest)
     {
@@ -137,13 +142,33 @@ void render_texture(SDL_Renderer* renderer,
       const Rect new_srcrect(math::positive_mod(rect.get_left(), static_cast<int>(imgrect.get_width())),
                              math::positive_mod(rect.get_top(), static_cast<int>(imgrect.get_height())),
                              Size(rect.get_width(), rect.get_height()));
-      render_texture(renderer, texture, imgrect,
-                     new_srcrect, relative_map(rectf, srcrect, dstrect));
+      split_wrapped(imgrect, new_srcrect, relative_map(rectf, srcrect, dstrect), emit);
     }
   }
 }
 
-/* A version SDL_RenderCopyEx that supports texture animation as specified by Sampler */
+void render_texture(SDL_Renderer* renderer,
+                    SDL_Texture* texture, const Rectf& imgrect,
+                    const Rect& srcrect, const Rectf& dstrect)
+{
+  split_wrapped(imgrect, srcrect, dstrect,
+                [renderer, texture](const Rect& src, const Rectf& dst) {
+                  SDL_Rect sdl_srcrect = src.to_sdl();
+                  SDL_FRect sdl_dstrect = dst.to_sdl();
+                  SDL_RenderCopyF(renderer, texture, &sdl_srcrect, &sdl_dstrect);
+                });
+}
+
+/* True if srcrect reaches beyond the texture and the sampler asks
+   for the texture to be repeated there */
+bool needs_repeat(const Sampler& sampler, const Rect& srcrect, int width, int height)
+{
+  return (sampler.get_wrap_s() == GL_REPEAT || sampler.get_wrap_t() == GL_REPEAT) &&
+         !Rect(0, 0, width, height).contains(srcrect);
+}
+
+/* A version SDL_RenderCopyEx that supports texture animation and
+   repeating as specified by Sampler */
 void RenderCopyEx(SDL_Renderer*          renderer,
                   SDL_Texture*           texture,
                   const SDL_Rect*        sdl_srcrect,
@@ -153,18 +178,24 @@ void RenderCopyEx(SDL_Renderer*          renderer,
                   const SDL_RendererFlip flip,
                   const Sampler& sampler)
 {
+  int width;
+  int height;
+
+  SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+
   Vector animate = sampler.get_animate();
-  if (animate.x == 0.0f && animate.y == 0.0f)
+  const bool repeat = needs_repeat(sampler, Rect(*sdl_srcrect), width, height);
+  if (animate.x == 0.0f && animate.y == 0.0f && !repeat)
   {
     SDL_RenderCopyExF(renderer, texture, sdl_srcrect, sdl_dstrect, angle, nullptr, flip);
   }
   else
   {
-    // This part deals with texture animation. Texture animation is
-    // accomplished by shifting the srcrect across the input texture.
-    // If the srcrect goes out of bounds of the texture, it is broken
-    // up into multiple rectangles that wrap around and fall back into
-    // the texture space.
+    // This part deals with texture animation and repeating. Texture
+    // animation is accomplished by shifting the srcrect across the
+    // input texture. If the srcrect goes out of bounds of the
+    // texture, it is broken up into multiple rectangles that wrap
+    // around and fall back into the texture space.
     //
     // If a srcrect is passed to SDL that goes out of bounds SDL will
     // clip it to be inside the bounds, without adjusting dstrect,
@@ -172,17 +203,12 @@ void RenderCopyEx(SDL_Renderer*          renderer,
     //
     // FIXME: Neither flipping nor wrap modes are supported at the
     // moment. wrap is treated as if it was set to 'repeat'.
-    int width;
-    int height;
-
-    SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
-
     animate *= g_game_time;
 
     int tex_off_x = math::positive_mod(static_cast<int>(animate.x), width);
     int tex_off_y = math::positive_mod(static_cast<int>(animate.y), height);
 
-    if ((tex_off_x == 0 && tex_off_y == 0) ||
+    if ((tex_off_x == 0 && tex_off_y == 0 && !repeat) ||
         flip ||
         angle != 0.0)
     {
@@ -200,12 +226,112 @@ void RenderCopyEx(SDL_Renderer*          renderer,
   }
 }
 
+/* Returns the colors at the start and the end of the gradient, for
+   the sector directions only the part visible on screen is covered */
+std::pair<Color, Color>
+gradient_range(const GradientRequest& request)
+{
+  const Color& top = request.top;
+  const Color& bottom = request.bottom;
+  const GradientDirection& direction = request.direction;
+  const Rectf& region = request.region;
+
+  if (direction != HORIZONTAL_SECTOR && direction != VERTICAL_SECTOR)
+    return std::make_pair(top, bottom);
+
+  float begin_percentage, end_percentage;
+  if (direction == HORIZONTAL_SECTOR)
+  {
+    begin_percentage = -region.get_left() / region.get_right();
+    end_percentage = (-region.get_left() + static_cast<float>(SCREEN_WIDTH)) / region.get_right();
+  }
+  else
+  {
+    begin_percentage = -region.get_top() / region.get_bottom();
+    end_percentage = (-region.get_top() + static_cast<float>(SCREEN_HEIGHT)) / region.get_bottom();
+  }
+
+  // This is needed because the limited floating point precision can produce
+  // values just below zero or just above one.
+  begin_percentage = math::clamp(begin_percentage, 0.0f, 1.0f);
+  end_percentage   = math::clamp(end_percentage,   0.0f, 1.0f);
+
+  Color begin, end;
+  begin.red   = top.red   * (1.0f - begin_percentage) + bottom.red   * begin_percentage;
+  begin.green = top.green * (1.0f - begin_percentage) + bottom.green * begin_percentage;
+  begin.blue  = top.blue  * (1.0f - begin_percentage) + bottom.blue  * begin_percentage;
+  begin.alpha = top.alpha * (1.0f - begin_percentage) + bottom.alpha * begin_percentage;
+
+  end.red   = top.red   * (1.0f - end_percentage) + bottom.red   * end_percentage;
+  end.green = top.green * (1.0f - end_percentage) + bottom.green * end_percentage;
+  end.blue  = top.blue  * (1.0f - end_percentage) + bottom.blue  * end_percentage;
+  end.alpha = top.alpha * (1.0f - end_percentage) + bottom.alpha * end_percentage;
+
+  return std::make_pair(begin, end);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/* Appends srcrect mapped to dstrect as two triangles, flipped and
+   rotated around the center of dstrect like SDL_RenderCopyEx() */
+void append_quad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                 const Rectf& srcrect, const Rectf& dstrect,
+                 float texture_width, float texture_height,
+                 float angle, Flip flip, const SDL_Color& color)
+{
+  float u0 = srcrect.get_left() / texture_width;
+  float v0 = srcrect.get_top() / texture_height;
+  float u1 = srcrect.get_right() / texture_width;
+  float v1 = srcrect.get_bottom() / texture_height;
+
+  if ((flip & HORIZONTAL_FLIP) != 0)
+    std::swap(u0, u1);
+
+  if ((flip & VERTICAL_FLIP) != 0)
+    std::swap(v0, v1);
+
+  std::array<SDL_FPoint, 4> corners{{
+    { dstrect.get_left(), dstrect.get_top() },
+    { dstrect.get_right(), dstrect.get_top() },
+    { dstrect.get_right(), dstrect.get_bottom() },
+    { dstrect.get_left(), dstrect.get_bottom() }
+  }};
+
+  if (angle != 0.0f)
+  {
+    const Vector center = dstrect.get_middle();
+    const float c = cosf(math::radians(angle));
+    const float s = sinf(math::radians(angle));
+    for (SDL_FPoint& corner : corners)
+    {
+      const float x = corner.x - center.x;
+      const float y = corner.y - center.y;
+      corner.x = center.x + x * c - y * s;
+      corner.y = center.y + x * s + y * c;
+    }
+  }
+
+  const int base = static_cast<int>(vertices.size());
+  vertices.push_back({ corners[0], color, { u0, v0 } });
+  vertices.push_back({ corners[1], color, { u1, v0 } });
+  vertices.push_back({ corners[2], color, { u1, v1 } });
+  vertices.push_back({ corners[3], color, { u0, v1 } });
+  indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+}
+
+#endif
+
 } // namespace
 
 SDLPainter::SDLPainter(SDLVideoSystem& video_system, Renderer& renderer, SDL_Renderer* sdl_renderer) :
   m_video_system(video_system),
   m_renderer(renderer),
   m_sdl_renderer(sdl_renderer),
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  m_vertices(),
+  m_indices(),
+#endif
+  m_rects(),
   m_cliprect()
 {}
 
@@ -217,19 +343,27 @@ SDLPainter::draw_texture(const TextureRequest& request)
   assert(request.srcrects.size() == request.dstrects.size());
   assert(request.srcrects.size() == request.angles.size());
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  if (draw_texture_geometry(request, texture))
+    return;
+#endif
+
   for (size_t i = 0; i < request.srcrects.size(); ++i)
   {
     const SDL_Rect& src_rect = request.srcrects[i].to_rect().to_sdl();
     const SDL_FRect& dst_rect = request.dstrects[i].to_sdl();
 
-    Uint8 r = static_cast<Uint8>(request.color.red * 255);
-    Uint8 g = static_cast<Uint8>(request.color.green * 255);
-    Uint8 b = static_cast<Uint8>(request.color.blue * 255);
-    Uint8 a = static_cast<Uint8>(request.color.alpha * request.alpha * 255);
+    const Color& color = request.colors.empty() ? request.color : request.colors[i];
+    Uint8 r = static_cast<Uint8>(color.red * 255);
+    Uint8 g = static_cast<Uint8>(color.green * 255);
+    Uint8 b = static_cast<Uint8>(color.blue * 255);
+    Uint8 a = static_cast<Uint8>(color.alpha * request.alpha * 255);
 
     SDL_SetTextureColorMod(texture.get_texture(), r, g, b);
     SDL_SetTextureAlphaMod(texture.get_texture(), a);
     SDL_SetTextureBlendMode(texture.get_texture(), blend2sdl(request.blend));
+    g_render_stats.count_texture_bind(request.texture);
+    g_render_stats.count_blend(static_cast<int>(blend2sdl(request.blend)), 0);
 
     SDL_RendererFlip flip = SDL_FLIP_NONE;
     if ((request.flip & HORIZONTAL_FLIP) != 0)
@@ -246,17 +380,26 @@ SDLPainter::draw_texture(const TextureRequest& request)
                  &src_rect, &dst_rect,
                  static_cast<double>(request.angles[i]), nullptr, flip,
                  texture.get_sampler());
+    g_render_stats.count_draw_call(4);
   }
 }
 
 void
 SDLPainter::draw_gradient(const GradientRequest& request)
 {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  if (draw_gradient_geometry(request))
+    return;
+#endif
+
   const Color& top = request.top;
   const Color& bottom = request.bottom;
   const GradientDirection& direction = request.direction;
   const Rectf& region = request.region;
 
+  Color begin, end;
+  std::tie(begin, end) = gradient_range(request);
+
   // calculate the maximum number of steps needed for the gradient
   int n = static_cast<int>(std::max(std::max(fabsf(top.red - bottom.red),
                                              fabsf(top.green - bottom.green)),
@@ -298,57 +441,145 @@ SDLPainter::draw_gradient(const GradientRequest& request)
     }
 
     float p = static_cast<float>(i) / static_cast<float>(n == 1 ? n : n - 1);
-    Uint8 r, g, b, a;
+    Uint8 r = static_cast<Uint8>(((1.0f - p) * begin.red   + p * end.red)   * 255);
+    Uint8 g = static_cast<Uint8>(((1.0f - p) * begin.green + p * end.green) * 255);
+    Uint8 b = static_cast<Uint8>(((1.0f - p) * begin.blue  + p * end.blue)  * 255);
+    Uint8 a = static_cast<Uint8>(((1.0f - p) * begin.alpha + p * end.alpha) * 255);
+
+    SDL_SetRenderDrawBlendMode(m_sdl_renderer, blend2sdl(request.blend));
+    SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
+    SDL_RenderFillRect(m_sdl_renderer, &rect);
+    g_render_stats.count_blend(static_cast<int>(blend2sdl(request.blend)), 0);
+    g_render_stats.count_draw_call(4);
+  }
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+bool
+SDLPainter::draw_texture_geometry(const TextureRequest& request, const SDLTexture& texture)
+{
+  const int width = texture.get_texture_width();
+  const int height = texture.get_texture_height();
+
+  // Texture animation and repeating are handled like in
+  // RenderCopyEx(), except that the pieces of a wrapped srcrect end
+  // up in the same batch.
+  const Vector animate = texture.get_sampler().get_animate() * g_game_time;
+  const int tex_off_x = math::positive_mod(static_cast<int>(animate.x), width);
+  const int tex_off_y = math::positive_mod(static_cast<int>(animate.y), height);
+  const bool animated = (tex_off_x != 0 || tex_off_y != 0) && request.flip == NO_FLIP;
+
+  // The shifted srcrects can be taken straight from the wrapped copy
+  // of the texture as long as none of them is larger than the texture.
+  SDL_Texture* sdl_texture = texture.get_texture();
+  if (animated && texture.get_wrapped_texture() &&
+      std::all_of(request.srcrects.begin(), request.srcrects.end(),
+                  [width, height](const Rectf& rect) {
+                    return rect.get_width() <= static_cast<float>(width) &&
+                           rect.get_height() <= static_cast<float>(height);
+                  }))
+  {
+    sdl_texture = texture.get_wrapped_texture();
+  }
 
-    if (direction == HORIZONTAL_SECTOR || direction == VERTICAL_SECTOR)
+  const bool wrapped = (sdl_texture != texture.get_texture());
+  const float uv_width = static_cast<float>(wrapped ? 2 * width : width);
+  const float uv_height = static_cast<float>(wrapped ? 2 * height : height);
+  const Rectf imgrect(Vector(), Sizef(static_cast<float>(width), static_cast<float>(height)));
+
+  m_vertices.clear();
+  m_indices.clear();
+
+  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  {
+    const Color& color = request.colors.empty() ? request.color : request.colors[i];
+    const SDL_Color sdl_color = Color(color.red, color.green, color.blue,
+                                      color.alpha * request.alpha).to_sdl_color();
+
+    const Rect srcrect = request.srcrects[i].to_rect();
+    const Rectf& dstrect = request.dstrects[i];
+
+    const bool repeat = request.angles[i] == 0.0f && request.flip == NO_FLIP &&
+                        needs_repeat(texture.get_sampler(), srcrect, width, height);
+
+    if ((!animated && !repeat) || request.angles[i] != 0.0f)
+    {
+      append_quad(m_vertices, m_indices, srcrect.to_rectf(), dstrect,
+                  uv_width, uv_height, request.angles[i], request.flip, sdl_color);
+    }
+    else
     {
-      float begin_percentage, end_percentage;
-      if (direction == HORIZONTAL_SECTOR)
+      const Rect shifted(math::positive_mod(srcrect.get_left() + tex_off_x, width),
+                         math::positive_mod(srcrect.get_top() + tex_off_y, height),
+                         Size(srcrect.get_width(), srcrect.get_height()));
+
+      if (wrapped)
       {
-        begin_percentage = -region.get_left() / region.get_right();
-        end_percentage = (-region.get_left() + static_cast<float>(SCREEN_WIDTH)) / region.get_right();
+        append_quad(m_vertices, m_indices, shifted.to_rectf(), dstrect,
+                    uv_width, uv_height, 0.0f, NO_FLIP, sdl_color);
       }
       else
       {
-        begin_percentage = -region.get_top() / region.get_bottom();
-        end_percentage = (-region.get_top() + static_cast<float>(SCREEN_HEIGHT)) / region.get_bottom();
+        split_wrapped(imgrect, shifted, dstrect,
+                      [this, uv_width, uv_height, &sdl_color](const Rect& src, const Rectf& dst) {
+                        append_quad(m_vertices, m_indices, src.to_rectf(), dst,
+                                    uv_width, uv_height, 0.0f, NO_FLIP, sdl_color);
+                      });
       }
-
-      // This is needed because the limited floating point precision can produce
-      // values just below zero or just above one.
-      begin_percentage = math::clamp(begin_percentage, 0.0f, 1.0f);
-      end_percentage   = math::clamp(end_percentage,   0.0f, 1.0f);
-
-      Color begin, end;
-      begin.red   = top.red   * (1.0f - begin_percentage) + bottom.red   * begin_percentage;
-      begin.green = top.green * (1.0f - begin_percentage) + bottom.green * begin_percentage;
-      begin.blue  = top.blue  * (1.0f - begin_percentage) + bottom.blue  * begin_percentage;
-      begin.alpha = top.alpha * (1.0f - begin_percentage) + bottom.alpha * begin_percentage;
-
-      end.red   = top.red   * (1.0f - end_percentage) + bottom.red   * end_percentage;
-      end.green = top.green * (1.0f - end_percentage) + bottom.green * end_percentage;
-      end.blue  = top.blue  * (1.0f - end_percentage) + bottom.blue  * end_percentage;
-      end.alpha = top.alpha * (1.0f - end_percentage) + bottom.alpha * end_percentage;
-
-      r = static_cast<Uint8>(((1.0f - p) * begin.red   + p * end.red)   * 255);
-      g = static_cast<Uint8>(((1.0f - p) * begin.green + p * end.green) * 255);
-      b = static_cast<Uint8>(((1.0f - p) * begin.blue  + p * end.blue)  * 255);
-      a = static_cast<Uint8>(((1.0f - p) * begin.alpha + p * end.alpha) * 255);
-    }
-    else
-    {
-      r = static_cast<Uint8>(((1.0f - p) * top.red   + p * bottom.red)   * 255);
-      g = static_cast<Uint8>(((1.0f - p) * top.green + p * bottom.green) * 255);
-      b = static_cast<Uint8>(((1.0f - p) * top.blue  + p * bottom.blue)  * 255);
-      a = static_cast<Uint8>(((1.0f - p) * top.alpha + p * bottom.alpha) * 255);
     }
+  }
 
-    SDL_SetRenderDrawBlendMode(m_sdl_renderer, blend2sdl(request.blend));
-    SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
-    SDL_RenderFillRect(m_sdl_renderer, &rect);
+  if (m_vertices.empty())
+    return true;
+
+  // The color is carried by the vertices.
+  SDL_SetTextureColorMod(sdl_texture, 255, 255, 255);
+  SDL_SetTextureAlphaMod(sdl_texture, 255);
+  SDL_SetTextureBlendMode(sdl_texture, blend2sdl(request.blend));
+
+  if (SDL_RenderGeometry(m_sdl_renderer, sdl_texture,
+                         m_vertices.data(), static_cast<int>(m_vertices.size()),
+                         m_indices.data(), static_cast<int>(m_indices.size())) != 0)
+  {
+    return false;
   }
+
+  g_render_stats.count_texture_bind(request.texture);
+  g_render_stats.count_blend(static_cast<int>(blend2sdl(request.blend)), 0);
+  g_render_stats.count_draw_call(static_cast<int>(m_vertices.size()));
+  return true;
 }
 
+bool
+SDLPainter::draw_gradient_geometry(const GradientRequest& request)
+{
+  const Rectf& region = request.region;
+  const bool vertical = (request.direction == VERTICAL || request.direction == VERTICAL_SECTOR);
+
+  Color begin, end;
+  std::tie(begin, end) = gradient_range(request);
+
+  const SDL_Color sdl_begin = begin.to_sdl_color();
+  const SDL_Color sdl_end = end.to_sdl_color();
+
+  const SDL_Vertex vertices[4] = {
+    { { region.get_left(), region.get_top() }, sdl_begin, { 0.0f, 0.0f } },
+    { { region.get_right(), region.get_top() }, vertical ? sdl_begin : sdl_end, { 0.0f, 0.0f } },
+    { { region.get_right(), region.get_bottom() }, sdl_end, { 0.0f, 0.0f } },
+    { { region.get_left(), region.get_bottom() }, vertical ? sdl_end : sdl_begin, { 0.0f, 0.0f } }
+  };
+  const int indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+  SDL_SetRenderDrawBlendMode(m_sdl_renderer, blend2sdl(request.blend));
+  if (SDL_RenderGeometry(m_sdl_renderer, nullptr, vertices, 4, indices, 6) != 0)
+    return false;
+
+  g_render_stats.count_blend(static_cast<int>(blend2sdl(request.blend)), 0);
+  g_render_stats.count_draw_call(4);
+  return true;
+}
+#endif
+
 void
 SDLPainter::draw_filled_rect(const FillRectRequest& request)
 {
@@ -406,6 +637,8 @@ SDLPainter::draw_filled_rect(const FillRectRequest& request)
     SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
     SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
     SDL_RenderFillRectsF(m_sdl_renderer, &*rects.begin(), static_cast<int>(rects.size()));
+    g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+    g_render_stats.count_draw_call(static_cast<int>(rects.size()) * 4);
   }
   else
   {
@@ -414,10 +647,37 @@ SDLPainter::draw_filled_rect(const FillRectRequest& request)
       SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
       SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
       SDL_RenderFillRectF(m_sdl_renderer, &rect);
+      g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+      g_render_stats.count_draw_call(4);
     }
   }
 }
 
+void
+SDLPainter::draw_filled_rects(const FillRectsRequest& request)
+{
+  m_rects.clear();
+  for (const auto& rect : request.rects)
+  {
+    if (rect.get_width() != 0 && rect.get_height() != 0)
+      m_rects.push_back(rect.to_sdl());
+  }
+
+  if (m_rects.empty())
+    return;
+
+  Uint8 r = static_cast<Uint8>(request.color.red * 255);
+  Uint8 g = static_cast<Uint8>(request.color.green * 255);
+  Uint8 b = static_cast<Uint8>(request.color.blue * 255);
+  Uint8 a = static_cast<Uint8>(request.color.alpha * 255);
+
+  SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
+  SDL_RenderFillRectsF(m_sdl_renderer, m_rects.data(), static_cast<int>(m_rects.size()));
+  g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+  g_render_stats.count_draw_call(static_cast<int>(m_rects.size()) * 4);
+}
+
 void
 SDLPainter::draw_inverse_ellipse(const InverseEllipseRequest& request)
 {
@@ -472,6 +732,8 @@ SDLPainter::draw_inverse_ellipse(const InverseEllipseRequest& request)
   SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
   SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
   SDL_RenderFillRectsF(m_sdl_renderer, rects, 2*slices+2);
+  g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+  g_render_stats.count_draw_call((2*slices+2) * 4);
 }
 
 void
@@ -486,6 +748,8 @@ SDLPainter::draw_line(const LineRequest& request)
   SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
   SDL_RenderDrawLineF(m_sdl_renderer, request.pos.x, request.pos.y,
                                       request.dest_pos.x, request.dest_pos.y);
+  g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+  g_render_stats.count_draw_call(2);
 }
 
 namespace {
@@ -535,6 +799,28 @@ draw_span_between_edges(SDL_Renderer* renderer, const Edge& e1, const Edge& e2)
 
 } // namespace
 
+void
+SDLPainter::draw_lines(const LinesRequest& request)
+{
+  Uint8 r = static_cast<Uint8>(request.color.red * 255);
+  Uint8 g = static_cast<Uint8>(request.color.green * 255);
+  Uint8 b = static_cast<Uint8>(request.color.blue * 255);
+  Uint8 a = static_cast<Uint8>(request.color.alpha * 255);
+
+  SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
+
+  // SDL_RenderDrawLinesF() only draws connected lines, so every segment
+  // is a call of its own. The SDL renderer may still batch them.
+  for (size_t i = 0; i + 1 < request.points.size(); i += 2)
+  {
+    SDL_RenderDrawLineF(m_sdl_renderer, request.points[i].x, request.points[i].y,
+                                        request.points[i + 1].x, request.points[i + 1].y);
+    g_render_stats.count_draw_call(2);
+  }
+  g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+}
+
 void
 SDLPainter::draw_triangle(const TriangleRequest& request)
 {
@@ -570,6 +856,8 @@ SDLPainter::draw_triangle(const TriangleRequest& request)
 
   draw_span_between_edges(m_sdl_renderer, edges[longEdge], edges[shortEdge1]);
   draw_span_between_edges(m_sdl_renderer, edges[longEdge], edges[shortEdge2]);
+  g_render_stats.count_blend(SDL_BLENDMODE_BLEND, 0);
+  g_render_stats.count_draw_call(3);
 }
 
 void
@@ -19,10 +19,13 @@
 
 #include "video/painter.hpp"
 
+#include <SDL.h>
 #include <optional>
+#include <vector>
 
 class Renderer;
 class SDLScreenRenderer;
+class SDLTexture;
 class SDLVideoSystem;
 struct DrawingRequest;
 struct SDL_Renderer;
@@ -35,8 +38,10 @@ public:
   virtual void draw_texture(const TextureRequest& request) override;
   virtual void draw_gradient(const GradientRequest& request) override;
   virtual void draw_filled_rect(const FillRectRequest& request) override;
+  virtual void draw_filled_rects(const FillRectsRequest& request) override;
   virtual void draw_inverse_ellipse(const InverseEllipseRequest& request) override;
   virtual void draw_line(const LineRequest& request) override;
+  virtual void draw_lines(const LinesRequest& request) override;
   virtual void draw_triangle(const TriangleRequest& request) override;
 
   virtual void clear(const Color& color) override;
@@ -45,10 +50,29 @@ public:
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
 
+private:
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  /** Submit all quads of the request with a single
+      SDL_RenderGeometry() call, returns false if the renderer
+      refused the geometry. */
+  bool draw_texture_geometry(const TextureRequest& request, const SDLTexture& texture);
+
+  /** Draw the gradient as a single vertex-coloured quad. */
+  bool draw_gradient_geometry(const GradientRequest& request);
+#endif
+
 private:
   SDLVideoSystem& m_video_system;
   Renderer& m_renderer;
   SDL_Renderer* m_sdl_renderer;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  /** Scratch buffers reused across requests. */
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+#endif
+  std::vector<SDL_FRect> m_rects;
+
   std::optional<SDL_Rect> m_cliprect;
 
 private:
@@ -19,12 +19,28 @@
 #include <SDL.h>
 #include <sstream>
 
+#include "util/log.hpp"
 #include "video/sdl/sdl_screen_renderer.hpp"
+#include "video/sdl_surface.hpp"
 #include "video/video_system.hpp"
 
+namespace {
+
+/** Textures larger than this along either axis don't get a wrapped
+    copy, as it would take four times their memory. */
+const int MAX_WRAPPED_SIZE = 2048;
+
+SDL_Renderer* current_sdl_renderer()
+{
+  return static_cast<SDLScreenRenderer&>(VideoSystem::current()->get_renderer()).get_sdl_renderer();
+}
+
+} // namespace
+
 SDLTexture::SDLTexture(SDL_Texture* texture, int width, int height, const Sampler& sampler) :
   Texture(sampler),
   m_texture(texture),
+  m_wrapped_texture(),
   m_width(width),
   m_height(height)
 {
@@ -33,6 +49,7 @@ SDLTexture::SDLTexture(SDL_Texture* texture, int width, int height, const Sample
 SDLTexture::SDLTexture(const SDL_Surface& image, const Sampler& sampler) :
   Texture(sampler),
   m_texture(),
+  m_wrapped_texture(),
   m_width(),
   m_height()
 {
@@ -43,9 +60,10 @@ void
 SDLTexture::reload(const SDL_Surface& image)
 {
   SDL_DestroyTexture(m_texture);
+  SDL_DestroyTexture(m_wrapped_texture);
+  m_wrapped_texture = nullptr;
 
-  m_texture = SDL_CreateTextureFromSurface(static_cast<SDLScreenRenderer&>(VideoSystem::current()->get_renderer()).get_sdl_renderer(),
-                                           const_cast<SDL_Surface*>(&image));
+  m_texture = SDL_CreateTextureFromSurface(current_sdl_renderer(), const_cast<SDL_Surface*>(&image));
   if (!m_texture)
   {
     std::ostringstream msg;
@@ -55,10 +73,47 @@ SDLTexture::reload(const SDL_Surface& image)
 
   m_width = image.w;
   m_height = image.h;
+
+  const Vector animate = m_sampler.get_animate();
+  if ((animate.x != 0.0f || animate.y != 0.0f) &&
+      m_width <= MAX_WRAPPED_SIZE && m_height <= MAX_WRAPPED_SIZE)
+  {
+    create_wrapped_texture(image);
+  }
+}
+
+void
+SDLTexture::create_wrapped_texture(const SDL_Surface& image)
+{
+  SDLSurfacePtr wrapped = SDLSurface::create_rgba(m_width * 2, m_height * 2);
+
+  // The pixels have to be copied as they are, alpha included. The image
+  // is shared with other users, so its blend mode is put back after.
+  SDL_Surface* source = const_cast<SDL_Surface*>(&image);
+  SDL_BlendMode blend_mode;
+  SDL_GetSurfaceBlendMode(source, &blend_mode);
+  SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+  for (int y = 0; y < 2; ++y)
+  {
+    for (int x = 0; x < 2; ++x)
+    {
+      SDL_Rect dstrect{x * m_width, y * m_height, m_width, m_height};
+      SDL_BlitSurface(source, nullptr, wrapped.get(), &dstrect);
+    }
+  }
+  SDL_SetSurfaceBlendMode(source, blend_mode);
+
+  m_wrapped_texture = SDL_CreateTextureFromSurface(current_sdl_renderer(), wrapped.get());
+  if (!m_wrapped_texture)
+  {
+    // Not fatal, the painter falls back to splitting the source rectangles.
+    log_warning << "couldn't create wrapped texture: " << SDL_GetError() << std::endl;
+  }
 }
 
 SDLTexture::~SDLTexture()
 {
+  SDL_DestroyTexture(m_wrapped_texture);
   SDL_DestroyTexture(m_texture);
 }
 
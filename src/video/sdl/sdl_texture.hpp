@@ -41,8 +41,17 @@ public:
   inline SDL_Texture *get_texture() const { return m_texture; }
   inline const Sampler& get_sampler() const { return m_sampler; }
 
+  /** A copy of the texture tiled 2x2, only available for animated
+      textures. Any texture-sized source rectangle shifted by the
+      animation offset fits into it without wrapping around. */
+  inline SDL_Texture* get_wrapped_texture() const { return m_wrapped_texture; }
+
+private:
+  void create_wrapped_texture(const SDL_Surface& image);
+
 private:
   SDL_Texture* m_texture;
+  SDL_Texture* m_wrapped_texture;
   int m_width;
   int m_height;
 
@@ -65,6 +65,12 @@ SDLTextureRenderer::start_draw()
       throw std::runtime_error(msg.str());
     }
 
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    // The lightmap is rendered at a fraction of the screen resolution,
+    // make sure it is smoothly upscaled regardless of the render hint.
+    SDL_SetTextureScaleMode(sdl_texture, SDL_ScaleModeLinear);
+#endif
+
     m_texture = TexturePtr(new SDLTexture(sdl_texture, w, h, Sampler()));
   }
 
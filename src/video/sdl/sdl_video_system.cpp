@@ -29,14 +29,19 @@
 #include "video/sdl_surface.hpp"
 #include "video/texture_manager.hpp"
 
-SDLVideoSystem::SDLVideoSystem() :
+SDLVideoSystem::SDLVideoSystem(bool offscreen) :
+  m_offscreen(offscreen),
+  m_offscreen_surface(),
   m_sdl_renderer(nullptr, &SDL_DestroyRenderer),
   m_viewport(),
   m_renderer(),
   m_lightmap(),
   m_texture_manager()
 {
-  create_window();
+  if (m_offscreen)
+    create_offscreen_surface();
+  else
+    create_window();
 
   m_renderer.reset(new SDLScreenRenderer(*this, m_sdl_renderer.get()));
   m_texture_manager.reset(new TextureManager);
@@ -79,12 +84,35 @@ SDLVideoSystem::create_window()
   }
 }
 
+void
+SDLVideoSystem::create_offscreen_surface()
+{
+  log_info << "Creating offscreen SDLVideoSystem" << std::endl;
+
+  m_offscreen_surface = SDLSurface::create_rgba(g_config->window_size.width, g_config->window_size.height);
+  m_desktop_size = g_config->window_size;
+
+  m_sdl_renderer.reset(SDL_CreateSoftwareRenderer(m_offscreen_surface.get()));
+  if (!m_sdl_renderer)
+  {
+    std::stringstream msg;
+    msg << "Couldn't create software SDL_Renderer: " << SDL_GetError();
+    throw std::runtime_error(msg.str());
+  }
+}
+
 void
 SDLVideoSystem::apply_config()
 {
-  apply_video_mode();
+  if (m_offscreen)
+  {
+    // The surface can't be resized, so the window size is fixed.
+    m_viewport = Viewport::from_size(get_window_size(), m_desktop_size);
+  }
+  else
+  {
+    apply_video_mode();
 
-  { // apply_viewport
     Size target_size = (g_config->use_fullscreen && g_config->fullscreen_size != Size(0, 0)) ?
       g_config->fullscreen_size :
       g_config->window_size;
@@ -92,7 +120,7 @@ SDLVideoSystem::apply_config()
     m_viewport = Viewport::from_size(target_size, m_desktop_size);
   }
 
-  m_lightmap.reset(new SDLTextureRenderer(*this, m_sdl_renderer.get(), m_viewport.get_screen_size(), 5));
+  m_lightmap.reset(new SDLTextureRenderer(*this, m_sdl_renderer.get(), m_viewport.get_screen_size(), g_config->lightmap_downscale));
 }
 
 Renderer&
@@ -125,6 +153,30 @@ SDLVideoSystem::get_vsync() const
   return 0;
 }
 
+void
+SDLVideoSystem::set_title(const std::string& title)
+{
+  // There is no window to set it on in offscreen mode.
+  if (!m_offscreen)
+    SDLBaseVideoSystem::set_title(title);
+}
+
+void
+SDLVideoSystem::set_icon(const SDL_Surface& icon)
+{
+  if (!m_offscreen)
+    SDLBaseVideoSystem::set_icon(icon);
+}
+
+Size
+SDLVideoSystem::get_window_size() const
+{
+  if (m_offscreen)
+    return Size(m_offscreen_surface->w, m_offscreen_surface->h);
+
+  return SDLBaseVideoSystem::get_window_size();
+}
+
 void
 SDLVideoSystem::flip()
 {
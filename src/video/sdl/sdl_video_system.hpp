@@ -21,6 +21,7 @@
 #include <SDL.h>
 
 #include "math/size.hpp"
+#include "video/sdl_surface_ptr.hpp"
 #include "video/sdlbase_video_system.hpp"
 #include "video/viewport.hpp"
 
@@ -31,7 +32,10 @@ class TextureManager;
 class SDLVideoSystem final : public SDLBaseVideoSystem
 {
 public:
-  SDLVideoSystem();
+  /** When \a offscreen is set, no window is opened and everything is
+      drawn by SDL's software renderer into an in-memory surface of
+      the configured window size, e.g. for rendering on CI machines. */
+  SDLVideoSystem(bool offscreen = false);
   ~SDLVideoSystem() override;
 
   virtual std::string get_name() const override;
@@ -49,12 +53,23 @@ public:
   virtual void set_vsync(int mode) override;
   virtual int get_vsync() const override;
 
+  virtual void set_title(const std::string& title) override;
+  virtual void set_icon(const SDL_Surface& icon) override;
+  virtual Size get_window_size() const override;
+
   virtual SDLSurfacePtr make_screenshot() override;
 
 private:
   void create_window();
+  void create_offscreen_surface();
 
 private:
+  bool m_offscreen;
+
+  /** Render target of the software renderer in offscreen mode, has to
+      outlive m_sdl_renderer */
+  SDLSurfacePtr m_offscreen_surface;
+
   std::unique_ptr<SDL_Renderer, decltype(&SDL_DestroyRenderer)> m_sdl_renderer;
   Viewport m_viewport;
   std::unique_ptr<SDLScreenRenderer> m_renderer;
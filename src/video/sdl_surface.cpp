@@ -92,6 +92,21 @@ SDLSurface::from_file(const std::string& filename)
 
 int
 SDLSurface::save_png(const SDL_Surface& surface, const std::string& filename)
+{
+  std::string error;
+  if (!save_png(surface, filename, error))
+  {
+    log_warning << error << std::endl;
+    return false;
+  }
+  else
+  {
+    return true;
+  }
+}
+
+bool
+SDLSurface::save_png(const SDL_Surface& surface, const std::string& filename, std::string& error)
 {
   // This does not lead to a double free when 'tmp == screen', as
   // SDL_PNGFormatAlpha() will increase the refcount of surface.
@@ -100,14 +115,13 @@ SDLSurface::save_png(const SDL_Surface& surface, const std::string& filename)
   try {
     ops = get_writable_physfs_SDLRWops(filename);
   } catch (std::exception& e) {
-    log_warning << "Could not get SDLRWops for " << filename << ": " <<
-      e.what() << std::endl;
+    error = "Could not get SDLRWops for " + filename + ": " + e.what();
     return false;
   }
   int ret = SDL_SavePNG_RW(tmp.get(), ops, 1);
   if (ret < 0)
   {
-    log_warning << "Saving " << filename << " failed: " << SDL_GetError() << std::endl;
+    error = "Saving " + filename + " failed: " + SDL_GetError();
     return false;
   }
   else
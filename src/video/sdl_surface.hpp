@@ -29,6 +29,10 @@ public:
   static SDLSurfacePtr create_rgb(int width, int height);
   static SDLSurfacePtr from_file(const std::string& filename);
   static int save_png(const SDL_Surface& surface, const std::string& filename);
+
+  /** Like save_png(), but reports failure through \a error instead of
+      the log, so that it can be used outside of the main thread. */
+  static bool save_png(const SDL_Surface& surface, const std::string& filename, std::string& error);
 };
 
 #endif
@@ -140,6 +140,29 @@ Surface::region(const Rect& rect) const
   return surface;
 }
 
+SurfacePtr
+Surface::repeated() const
+{
+  const Texture& texture = *m_diffuse_texture;
+  if (!(m_region == Rect(0, 0, texture.get_image_width(), texture.get_image_height())))
+    return {};
+
+  TexturePtr repeated;
+  if (texture.get_sampler().get_wrap_s() == GL_REPEAT &&
+      texture.get_sampler().get_wrap_t() == GL_REPEAT)
+    repeated = m_diffuse_texture;
+  else
+    repeated = TextureManager::current()->get_repeated(texture);
+
+  // Padding to a power of two would end up between the copies.
+  if (!repeated ||
+      repeated->get_texture_width() != repeated->get_image_width() ||
+      repeated->get_texture_height() != repeated->get_image_height())
+    return {};
+
+  return SurfacePtr(new Surface(repeated, m_displacement_texture, m_flip, m_source_filename));
+}
+
 TexturePtr
 Surface::get_texture() const
 {
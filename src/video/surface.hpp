@@ -49,6 +49,12 @@ public:
   SurfacePtr region(const Rect& rect) const;
   SurfacePtr clone(Flip flip = NO_FLIP) const;
 
+  /** Returns the same image with a texture that repeats beyond its
+      edges, so that srcrects larger than the image tile it. Returns
+      nullptr if the surface is only part of its texture or the
+      texture is padded. */
+  SurfacePtr repeated() const;
+
   TexturePtr get_texture() const;
   TexturePtr get_displacement_texture() const;
   inline Rect get_region() const { return m_region; }
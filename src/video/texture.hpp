@@ -35,8 +35,8 @@ class Texture
   friend class TextureManager;
 
 public:
-  /** filename, left, top, right, bottom */
-  using Key = std::tuple<std::string, Rect>;
+  /** filename, left, top, right, bottom, wrap_s, wrap_t */
+  using Key = std::tuple<std::string, Rect, GLenum, GLenum>;
 
 protected:
   Texture();
@@ -200,7 +200,7 @@ TexturePtr
 TextureManager::get(const std::string& _filename)
 {
   std::string filename = FileSystem::normalize(_filename);
-  Texture::Key key(filename, Rect(0, 0, 0, 0));
+  Texture::Key key(filename, Rect(0, 0, 0, 0), GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
   auto i = m_image_textures.find(key);
 
   TexturePtr texture;
@@ -225,11 +225,11 @@ TextureManager::get(const std::string& _filename,
   Texture::Key key;
   if (rect)
   {
-    key = Texture::Key(filename, *rect);
+    key = Texture::Key(filename, *rect, sampler.get_wrap_s(), sampler.get_wrap_t());
   }
   else
   {
-    key = Texture::Key(filename, Rect());
+    key = Texture::Key(filename, Rect(), sampler.get_wrap_s(), sampler.get_wrap_t());
   }
 
   auto i = m_image_textures.find(key);
@@ -254,6 +254,20 @@ TextureManager::get(const std::string& _filename,
   return texture;
 }
 
+TexturePtr
+TextureManager::get_repeated(const Texture& texture)
+{
+  if (!texture.m_cache_key)
+    return {};
+
+  const Sampler& sampler = texture.get_sampler();
+  const Rect& rect = std::get<1>(*texture.m_cache_key);
+
+  return get(std::get<0>(*texture.m_cache_key),
+             rect.empty() ? std::nullopt : std::optional<Rect>(rect),
+             Sampler(sampler.get_filter(), GL_REPEAT, GL_REPEAT, sampler.get_animate()));
+}
+
 void
 TextureManager::reap_cache_entry(const Texture::Key& key)
 {
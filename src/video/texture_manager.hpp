@@ -55,6 +55,11 @@ public:
                  const Sampler& sampler = Sampler());
   TexturePtr create_dummy_texture() const;
 
+  /** Returns a texture of the same image as 'texture' that repeats
+      beyond its edges, or nullptr if 'texture' didn't come from an
+      image file. */
+  TexturePtr get_repeated(const Texture& texture);
+
   void reload();
 
   void debug_print(std::ostream& out) const;
@@ -17,17 +17,13 @@
 #include "video/video_system.hpp"
 
 #include <assert.h>
-#include <optional>
 #include <config.h>
-#include <iomanip>
-#include <physfs.h>
-#include <sstream>
+#include <stdexcept>
 
-#include "util/file_system.hpp"
 #include "util/log.hpp"
+#include "video/frame_capture.hpp"
 #include "video/null/null_video_system.hpp"
 #include "video/sdl/sdl_video_system.hpp"
-#include "video/sdl_surface.hpp"
 #include "video/sdl_surface_ptr.hpp"
 
 #ifdef HAVE_OPENGL
@@ -85,6 +81,9 @@ VideoSystem::create(VideoSystem::Enum video_system)
       log_info << "new SDL renderer\n";
       return std::make_unique<SDLVideoSystem>();
 
+    case VIDEO_OFFSCREEN:
+      return std::make_unique<SDLVideoSystem>(true);
+
     case VIDEO_NULL:
       return std::make_unique<NullVideoSystem>();
 
@@ -116,6 +115,10 @@ VideoSystem::get_video_system(const std::string &video)
   {
     return VIDEO_SDL;
   }
+  else if (video == "offscreen")
+  {
+    return VIDEO_OFFSCREEN;
+  }
   else if (video == "null")
   {
     return VIDEO_NULL;
@@ -123,9 +126,9 @@ VideoSystem::get_video_system(const std::string &video)
   else
   {
 #ifdef HAVE_OPENGL
-    throw std::runtime_error("invalid VideoSystem::Enum, valid values are 'auto', 'sdl', 'opengl', 'opengl20' and 'null'");
+    throw std::runtime_error("invalid VideoSystem::Enum, valid values are 'auto', 'sdl', 'opengl', 'opengl20', 'offscreen' and 'null'");
 #else
-    throw std::runtime_error("invalid VideoSystem::Enum, valid values are 'auto' and 'sdl'");
+    throw std::runtime_error("invalid VideoSystem::Enum, valid values are 'auto', 'sdl', 'offscreen' and 'null'");
 #endif
   }
 }
@@ -143,6 +146,8 @@ VideoSystem::get_video_string(VideoSystem::Enum video)
       return "opengl20";
     case VIDEO_SDL:
       return "sdl";
+    case VIDEO_OFFSCREEN:
+      return "offscreen";
     case VIDEO_NULL:
       return "null";
     default:
@@ -165,52 +170,31 @@ VideoSystem::get_available_video_systems()
   return output;
 }
 
-void
-VideoSystem::do_take_screenshot()
+VideoSystem::VideoSystem() :
+  m_frame_capture(std::make_unique<FrameCapture>(*this))
 {
-  SDLSurfacePtr surface = make_screenshot();
-  if (!surface) {
-    log_warning << "Creating the screenshot has failed" << std::endl;
-    return;
-  }
+}
 
-  const std::string screenshots_dir = "/screenshots";
-  if (!PHYSFS_exists(screenshots_dir.c_str())) {
-    if (!PHYSFS_mkdir(screenshots_dir.c_str())) {
-      log_warning << "Creating '" << screenshots_dir << "' failed" << std::endl;
-      return;
-    }
-  }
+VideoSystem::~VideoSystem()
+{
+}
 
-  auto find_filename = [&]() -> std::optional<std::string>
-    {
-      for (int num = 0; num < 1000000; ++num)
-      {
-        std::ostringstream oss;
-        oss << "screenshot" << std::setw(6) << std::setfill('0') << num << ".png";
-        const std::string screenshot_filename = FileSystem::join(screenshots_dir, oss.str());
-        if (!PHYSFS_exists(screenshot_filename.c_str())) {
-          #ifdef __clang__
-            return std::move(screenshot_filename);
-          #else
-            return screenshot_filename;
-          #endif
-        }
-      }
-      return std::nullopt;
-    };
+bool
+VideoSystem::start_readback()
+{
+  return false;
+}
 
-  auto filename = find_filename();
-  if (!filename)
-  {
-    log_info << "Failed to find filename to save screenshot" << std::endl;
-  }
-  else
-  {
-    if (SDLSurface::save_png(*surface, *filename)) {
-      log_info << "Wrote screenshot to \"" << *filename << "\"" << std::endl;
-    }
-  }
+bool
+VideoSystem::finish_readback(SDLSurfacePtr& surface)
+{
+  return false;
+}
+
+void
+VideoSystem::do_take_screenshot()
+{
+  m_frame_capture->request_screenshot();
 }
 
 /* EOF */
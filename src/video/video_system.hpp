@@ -17,15 +17,18 @@
 #ifndef HEADER_SUPERTUX_VIDEO_VIDEO_SYSTEM_HPP
 #define HEADER_SUPERTUX_VIDEO_VIDEO_SYSTEM_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <SDL.h>
 
 #include "math/size.hpp"
 #include "util/currenton.hpp"
+#include "video/render_stats.hpp"
 #include "video/sampler.hpp"
 #include "video/texture_ptr.hpp"
 
+class FrameCapture;
 class Rect;
 class Renderer;
 class SDLSurfacePtr;
@@ -42,6 +45,7 @@ public:
     VIDEO_OPENGL33CORE,
     VIDEO_OPENGL20,
     VIDEO_SDL,
+    VIDEO_OFFSCREEN,
     VIDEO_NULL
   };
 
@@ -52,8 +56,8 @@ public:
   static std::vector<std::string> get_available_video_systems();
 
 public:
-  VideoSystem() {}
-  ~VideoSystem() override {}
+  VideoSystem();
+  ~VideoSystem() override;
 
   /** Return a human readable name of the current video system */
   virtual std::string get_name() const = 0;
@@ -76,8 +80,30 @@ public:
   virtual void set_icon(const SDL_Surface& icon) = 0;
   virtual SDLSurfacePtr make_screenshot() = 0;
 
+  /** Start reading back the frame that was just drawn without waiting
+      for it, returns false if that isn't supported or possible right
+      now, in which case make_screenshot() has to be used. */
+  virtual bool start_readback();
+
+  /** Returns false while the oldest readback is still in flight. Once
+      it has completed, returns true and stores the frame in surface,
+      which is left empty if reading it back failed. Readbacks finish
+      in the order they were started. */
+  virtual bool finish_readback(SDLSurfacePtr& surface);
+
+  /** Measure the GPU time spent on a render pass, results end up in
+      g_render_stats once available. No-op if unsupported. */
+  virtual void begin_gpu_timer(RenderStats::Pass pass) {}
+  virtual void end_gpu_timer(RenderStats::Pass pass) {}
+
+  /** Saves the next frame as screenshot, see FrameCapture */
   void do_take_screenshot();
 
+  inline FrameCapture& get_frame_capture() const { return *m_frame_capture; }
+
+private:
+  std::unique_ptr<FrameCapture> m_frame_capture;
+
 private:
   VideoSystem(const VideoSystem&) = delete;
   VideoSystem& operator=(const VideoSystem&) = delete;
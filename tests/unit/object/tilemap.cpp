@@ -0,0 +1,145 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "object/tilemap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <random>
+
+#include "supertux/tile.hpp"
+#include "supertux/tile_set.hpp"
+
+namespace {
+
+const uint32_t TILE_ATTRIBUTES[] = {
+  0,
+  Tile::SOLID,
+  Tile::UNISOLID,
+  Tile::SOLID | Tile::ICE,
+  Tile::WATER,
+  Tile::WATER | Tile::HURTS | Tile::FIRE
+};
+
+const uint32_t MASKS[] = {
+  Tile::SOLID,
+  Tile::SOLID | Tile::UNISOLID,
+  Tile::WATER,
+  Tile::HURTS,
+  Tile::ICE | Tile::FIRE
+};
+
+std::unique_ptr<TileSet>
+make_tileset()
+{
+  auto tileset = std::make_unique<TileSet>("");
+  for (size_t id = 1; id < std::size(TILE_ATTRIBUTES); ++id)
+  {
+    tileset->add_tile(static_cast<int>(id),
+                      std::make_unique<Tile>(std::vector<SurfacePtr>(), std::vector<SurfacePtr>(),
+                                             TILE_ATTRIBUTES[id], 0, 0.0f));
+  }
+  return tileset;
+}
+
+bool
+has_attributes_brute_force(const TileMap& tilemap, const Rect& tiles, uint32_t mask)
+{
+  for (int y = tiles.top; y < tiles.bottom; ++y)
+  {
+    for (int x = tiles.left; x < tiles.right; ++x)
+    {
+      if (TILE_ATTRIBUTES[tilemap.get_tile_id(x, y)] & mask)
+        return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+TEST(TileMap, has_attributes_change)
+{
+  auto tileset = make_tileset();
+  TileMap tilemap(tileset.get());
+  tilemap.resize(23, 17);
+
+  std::mt19937 rng(20260418);
+  std::uniform_int_distribution<uint32_t> tile_dist(0, static_cast<uint32_t>(std::size(TILE_ATTRIBUTES) - 1));
+  std::uniform_int_distribution<int> x_dist(0, tilemap.get_width() - 1);
+  std::uniform_int_distribution<int> y_dist(0, tilemap.get_height() - 1);
+
+  // Sector coordinates reaching past every edge of the map, so that
+  // the overlapping tile rectangles get clamped.
+  std::uniform_real_distribution<float> coord_x_dist(-96.0f, static_cast<float>(tilemap.get_width() * 32 + 96));
+  std::uniform_real_distribution<float> coord_y_dist(-96.0f, static_cast<float>(tilemap.get_height() * 32 + 96));
+
+  for (int x = 0; x < tilemap.get_width(); ++x)
+    for (int y = 0; y < tilemap.get_height(); ++y)
+      tilemap.change(x, y, tile_dist(rng));
+
+  for (int step = 0; step < 500; ++step)
+  {
+    // The tables are built by the first query and then kept up to date
+    // by change(), so every query after that covers the in-place update.
+    tilemap.change(x_dist(rng), y_dist(rng), tile_dist(rng));
+
+    for (int query = 0; query < 8; ++query)
+    {
+      float x1 = coord_x_dist(rng), x2 = coord_x_dist(rng);
+      float y1 = coord_y_dist(rng), y2 = coord_y_dist(rng);
+      const Rect tiles = tilemap.get_tiles_overlapping(Rectf(std::min(x1, x2), std::min(y1, y2),
+                                                             std::max(x1, x2), std::max(y1, y2)));
+
+      for (const uint32_t mask : MASKS)
+        ASSERT_EQ(has_attributes_brute_force(tilemap, tiles, mask), tilemap.has_attributes(tiles, mask));
+    }
+  }
+}
+
+TEST(TileMap, has_attributes_edges)
+{
+  auto tileset = make_tileset();
+  TileMap tilemap(tileset.get());
+  tilemap.resize(4, 3);
+
+  const Rect whole = tilemap.get_tiles_overlapping(Rectf(-1000.0f, -1000.0f, 1000.0f, 1000.0f));
+  EXPECT_EQ(Rect(0, 0, 4, 3), whole);
+  EXPECT_FALSE(tilemap.has_attributes(whole, Tile::SOLID));
+
+  // The last tile only shows up in the sums at the far corner.
+  tilemap.change(3, 2, 1);
+  EXPECT_TRUE(tilemap.has_attributes(whole, Tile::SOLID));
+  EXPECT_TRUE(tilemap.has_attributes(Rect(3, 2, 4, 3), Tile::SOLID));
+  EXPECT_FALSE(tilemap.has_attributes(Rect(0, 0, 3, 3), Tile::SOLID));
+  EXPECT_FALSE(tilemap.has_attributes(Rect(0, 0, 4, 2), Tile::SOLID));
+
+  tilemap.change(0, 0, 4);
+  tilemap.change(3, 2, 0);
+  EXPECT_FALSE(tilemap.has_attributes(whole, Tile::SOLID));
+  EXPECT_TRUE(tilemap.has_attributes(Rect(0, 0, 1, 1), Tile::WATER));
+  EXPECT_FALSE(tilemap.has_attributes(Rect(1, 0, 4, 3), Tile::WATER));
+
+  // Empty rectangles never match.
+  EXPECT_FALSE(tilemap.has_attributes(Rect(0, 0, 0, 3), Tile::WATER));
+  EXPECT_FALSE(tilemap.has_attributes(Rect(0, 1, 4, 1), Tile::WATER));
+}
+
+/* EOF */
@@ -0,0 +1,99 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/block_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+TEST(BlockPool, block_size)
+{
+  // Blocks are rounded up to hold a free list pointer at full alignment.
+  EXPECT_EQ(alignof(std::max_align_t), BlockPool(1).get_block_size());
+  EXPECT_EQ(alignof(std::max_align_t) * 2, BlockPool(alignof(std::max_align_t) + 1).get_block_size());
+  EXPECT_EQ(256u, BlockPool(256).get_block_size());
+}
+
+TEST(BlockPool, reuse)
+{
+  BlockPool pool(24, 4);
+  EXPECT_EQ(0u, pool.get_capacity());
+
+  void* a = pool.allocate();
+  void* b = pool.allocate();
+  EXPECT_EQ(2u, pool.get_used());
+  EXPECT_EQ(4u, pool.get_capacity());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a) % alignof(std::max_align_t));
+
+  // The block freed last is handed out first, without growing.
+  pool.deallocate(a);
+  EXPECT_EQ(1u, pool.get_used());
+  EXPECT_EQ(a, pool.allocate());
+
+  pool.deallocate(b);
+  pool.deallocate(a);
+  EXPECT_EQ(a, pool.allocate());
+  EXPECT_EQ(b, pool.allocate());
+  EXPECT_EQ(4u, pool.get_capacity());
+
+  pool.deallocate(nullptr);
+  EXPECT_EQ(2u, pool.get_used());
+}
+
+TEST(BlockPool, growth)
+{
+  BlockPool pool(40, 8);
+  const size_t block_size = pool.get_block_size();
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 8 * 3 + 1; ++i)
+  {
+    blocks.push_back(pool.allocate());
+    memset(blocks.back(), 0xaa, block_size);
+  }
+  EXPECT_EQ(blocks.size(), pool.get_used());
+  EXPECT_EQ(8u * 4, pool.get_capacity());
+
+  // No block is handed out twice and none overlap.
+  std::vector<unsigned char*> sorted;
+  for (void* block : blocks)
+    sorted.push_back(static_cast<unsigned char*>(block));
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 1; i < sorted.size(); ++i)
+    EXPECT_GE(sorted[i] - sorted[i - 1], static_cast<ptrdiff_t>(block_size));
+
+  // Blocks of a new chunk come lowest address first.
+  EXPECT_EQ(static_cast<unsigned char*>(blocks[0]) + block_size, blocks[1]);
+
+  for (void* block : blocks)
+    pool.deallocate(block);
+  EXPECT_EQ(0u, pool.get_used());
+
+  // Freed blocks from all chunks are reused before growing again.
+  std::set<void*> reused;
+  for (size_t i = 0; i < blocks.size(); ++i)
+    reused.insert(pool.allocate());
+  EXPECT_EQ(std::set<void*>(blocks.begin(), blocks.end()), reused);
+  EXPECT_EQ(8u * 4, pool.get_capacity());
+}
+
+/* EOF */
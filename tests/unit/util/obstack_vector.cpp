@@ -0,0 +1,129 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/obstack_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "util/obstackpp.hpp"
+
+namespace {
+
+struct Point
+{
+  int x;
+  int y;
+};
+
+} // namespace
+
+TEST(ObstackVector, emplace_back)
+{
+  obstack obst;
+  obstack_init(&obst);
+
+  {
+    ObstackVector<Point> vec(obst);
+    EXPECT_TRUE(vec.empty());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      Point& point = vec.emplace_back(Point{ i, -i });
+      EXPECT_EQ(i, point.x);
+    }
+
+    ASSERT_EQ(1000u, vec.size());
+    for (int i = 0; i < 1000; ++i)
+    {
+      EXPECT_EQ(i, vec[i].x);
+      EXPECT_EQ(-i, vec[i].y);
+    }
+
+    int count = 0;
+    for (const auto& point : vec)
+      count += (point.x == -point.y) ? 1 : 0;
+    EXPECT_EQ(1000, count);
+  }
+
+  obstack_free(&obst, nullptr);
+}
+
+TEST(ObstackVector, reserve)
+{
+  obstack obst;
+  obstack_init(&obst);
+
+  {
+    ObstackVector<int> vec(obst);
+    vec.reserve(16);
+    int* data = vec.data();
+    for (int i = 0; i < 16; ++i)
+      vec.push_back(i);
+    EXPECT_EQ(data, vec.data());
+
+    // Growing moves the elements to a new block.
+    vec.push_back(16);
+    EXPECT_NE(data, vec.data());
+    for (int i = 0; i <= 16; ++i)
+      EXPECT_EQ(i, vec[i]);
+
+    // A smaller reserve keeps the block.
+    data = vec.data();
+    vec.reserve(4);
+    EXPECT_EQ(data, vec.data());
+    EXPECT_EQ(17u, vec.size());
+  }
+
+  obstack_free(&obst, nullptr);
+}
+
+TEST(ObstackVector, assign)
+{
+  obstack obst;
+  obstack_init(&obst);
+
+  {
+    ObstackVector<int> vec(obst);
+    vec.push_back(1);
+    vec.push_back(2);
+
+    vec.assign(5, 7);
+    ASSERT_EQ(5u, vec.size());
+    for (int value : vec)
+      EXPECT_EQ(7, value);
+
+    const std::vector<int> values = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    vec.assign(values);
+    ASSERT_EQ(values.size(), vec.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), vec.begin()));
+
+    vec.assign(std::vector<int>());
+    EXPECT_TRUE(vec.empty());
+
+    vec.assign(0, 1);
+    EXPECT_TRUE(vec.empty());
+    vec.push_back(8);
+    EXPECT_EQ(8, vec[0]);
+  }
+
+  obstack_free(&obst, nullptr);
+}
+
+/* EOF */
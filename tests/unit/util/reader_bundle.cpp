@@ -0,0 +1,181 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/reader_bundle.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include <physfs.h>
+#include <sexp/parser.hpp>
+
+#include "physfs/ifile_stream.hpp"
+
+namespace {
+
+const char* const BUNDLE_FILE = "reader_bundle_test.bundle";
+const char* const BUNDLE_DIR = "/reader_bundle_test";
+const char* const VALUES_FILE = "reader_bundle/values.stl";
+
+void
+expect_same_value(const sexp::Value& expected, const sexp::Value& actual)
+{
+  ASSERT_EQ(expected.get_type(), actual.get_type());
+
+  switch (expected.get_type())
+  {
+    case sexp::Value::Type::BOOLEAN:
+      EXPECT_EQ(expected.as_bool(), actual.as_bool());
+      break;
+
+    case sexp::Value::Type::INTEGER:
+      EXPECT_EQ(expected.as_int(), actual.as_int());
+      break;
+
+    case sexp::Value::Type::REAL:
+      EXPECT_EQ(expected.as_float(), actual.as_float());
+      break;
+
+    case sexp::Value::Type::STRING:
+    case sexp::Value::Type::SYMBOL:
+      EXPECT_EQ(expected.as_string(), actual.as_string());
+      break;
+
+    case sexp::Value::Type::ARRAY:
+      ASSERT_EQ(expected.as_array().size(), actual.as_array().size());
+      for (size_t i = 0; i < expected.as_array().size(); ++i)
+        expect_same_value(expected.as_array()[i], actual.as_array()[i]);
+      break;
+
+    default:
+      break;
+  }
+}
+
+std::vector<char>
+read_bundle_data()
+{
+  std::ifstream in(BUNDLE_FILE, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+/** Writes the given bytes in place of the bundle and loads them, a
+    bundle that is rejected as a whole comes back empty */
+std::unique_ptr<ReaderBundle>
+load_bundle_data(const std::vector<char>& data)
+{
+  {
+    std::ofstream out(BUNDLE_FILE, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+  }
+
+  try
+  {
+    return std::make_unique<ReaderBundle>(std::string(BUNDLE_DIR) + "/" + BUNDLE_FILE);
+  }
+  catch (const std::runtime_error&)
+  {
+    return {};
+  }
+}
+
+class ReaderBundleTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    PHYSFS_init("reader_bundle_test");
+    PHYSFS_mount("../tests/data", nullptr, 1);
+
+    ASSERT_EQ(1, ReaderBundle::build(BUNDLE_FILE));
+    PHYSFS_mount(".", BUNDLE_DIR, 1);
+  }
+
+  void TearDown() override
+  {
+    PHYSFS_unmount(".");
+  }
+};
+
+} // namespace
+
+TEST_F(ReaderBundleTest, round_trip)
+{
+  ReaderBundle bundle(std::string(BUNDLE_DIR) + "/" + BUNDLE_FILE);
+  ASSERT_EQ(1u, bundle.size());
+
+  IFileStream in(VALUES_FILE);
+  const sexp::Value expected = sexp::Parser::from_stream(in, sexp::Parser::USE_ARRAYS);
+
+  const std::optional<sexp::Value> actual = bundle.find(VALUES_FILE);
+  ASSERT_TRUE(actual);
+  expect_same_value(expected, *actual);
+
+  // A leading slash names the same entry.
+  EXPECT_TRUE(bundle.find("/reader_bundle/values.stl"));
+  EXPECT_FALSE(bundle.find("reader_bundle/missing.stl"));
+}
+
+TEST_F(ReaderBundleTest, truncated)
+{
+  const std::vector<char> data = read_bundle_data();
+  ASSERT_FALSE(data.empty());
+
+  // Any cut either fails the header or leaves the only value incomplete.
+  for (size_t length = 0; length < data.size(); ++length)
+  {
+    auto bundle = load_bundle_data(std::vector<char>(data.begin(), data.begin() + length));
+    if (bundle)
+      EXPECT_FALSE(bundle->find(VALUES_FILE)) << "length " << length;
+  }
+}
+
+TEST_F(ReaderBundleTest, corrupt)
+{
+  const std::vector<char> data = read_bundle_data();
+  ASSERT_GT(data.size(), 12u);
+
+  {
+    std::vector<char> corrupt = data;
+    corrupt[0] = 'X';
+    EXPECT_FALSE(load_bundle_data(corrupt));
+  }
+
+  {
+    std::vector<char> corrupt = data;
+    corrupt[8] = static_cast<char>(0xff);
+    EXPECT_FALSE(load_bundle_data(corrupt));
+  }
+
+  // Damage anywhere else may only cost the entry, never crash or throw
+  // out of find().
+  for (size_t i = 12; i < data.size(); ++i)
+  {
+    std::vector<char> corrupt = data;
+    corrupt[i] = static_cast<char>(corrupt[i] ^ 0xff);
+
+    auto bundle = load_bundle_data(corrupt);
+    if (bundle)
+      EXPECT_NO_THROW(bundle->find(VALUES_FILE)) << "byte " << i;
+  }
+}
+
+/* EOF */
@@ -0,0 +1,92 @@
+//  SuperTux
+//  Copyright (C) 2026 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/size_class_allocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+TEST(SizeClassAllocator, size_classes)
+{
+  SizeClassAllocator allocator;
+  EXPECT_EQ(nullptr, allocator.get_pool(64));
+
+  void* a = allocator.allocate(64);
+  void* b = allocator.allocate(65);
+  void* c = allocator.allocate(2048);
+  void* d = allocator.allocate(2049);
+
+  // 64 is the last size of the first class, 65 starts the next one.
+  ASSERT_NE(nullptr, allocator.get_pool(1));
+  EXPECT_EQ(allocator.get_pool(1), allocator.get_pool(64));
+  EXPECT_NE(allocator.get_pool(64), allocator.get_pool(65));
+  EXPECT_EQ(allocator.get_pool(65), allocator.get_pool(128));
+  EXPECT_EQ(64u, allocator.get_pool(64)->get_block_size());
+  EXPECT_EQ(128u, allocator.get_pool(65)->get_block_size());
+  EXPECT_EQ(1u, allocator.get_pool(64)->get_used());
+  EXPECT_EQ(1u, allocator.get_pool(65)->get_used());
+
+  // 2048 is the largest pooled size, anything above goes to operator new.
+  ASSERT_NE(nullptr, allocator.get_pool(2048));
+  EXPECT_EQ(2048u, allocator.get_pool(2048)->get_block_size());
+  EXPECT_EQ(1u, allocator.get_pool(2048)->get_used());
+  EXPECT_EQ(nullptr, allocator.get_pool(2049));
+  EXPECT_EQ(nullptr, allocator.get_pool(0));
+
+  memset(a, 0, 64);
+  memset(b, 0, 65);
+  memset(c, 0, 2048);
+  memset(d, 0, 2049);
+
+  allocator.deallocate(a, 64);
+  allocator.deallocate(b, 65);
+  allocator.deallocate(c, 2048);
+  allocator.deallocate(d, 2049);
+  EXPECT_EQ(0u, allocator.get_pool(64)->get_used());
+  EXPECT_EQ(0u, allocator.get_pool(65)->get_used());
+  EXPECT_EQ(0u, allocator.get_pool(2048)->get_used());
+
+  // Sizes of the same class share their blocks.
+  EXPECT_EQ(b, allocator.allocate(100));
+  allocator.deallocate(b, 100);
+}
+
+TEST(SizeClassAllocator, large_sizes)
+{
+  SizeClassAllocator allocator;
+
+  // Sized deallocation above MAX_SIZE hands the memory back to
+  // operator delete instead of a pool.
+  for (size_t size : { SizeClassAllocator::MAX_SIZE + 1, static_cast<size_t>(4096), static_cast<size_t>(1 << 20) })
+  {
+    void* ptr = allocator.allocate(size);
+    ASSERT_NE(nullptr, ptr);
+    memset(ptr, 0x55, size);
+    allocator.deallocate(ptr, size);
+    EXPECT_EQ(nullptr, allocator.get_pool(size));
+  }
+
+  void* ptr = allocator.allocate(0);
+  allocator.deallocate(ptr, 0);
+  allocator.deallocate(nullptr, 4096);
+
+  for (size_t size = 1; size <= SizeClassAllocator::MAX_SIZE; size += SizeClassAllocator::GRANULARITY)
+    EXPECT_EQ(nullptr, allocator.get_pool(size));
+}
+
+/* EOF */